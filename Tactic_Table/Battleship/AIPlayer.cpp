@@ -0,0 +1,57 @@
+#include "AIPlayer.h"
+
+bool AIPlayer::SetupShips(Rng& setupRng) {
+    bool placed = grid.PlaceAllShips(setupRng);
+    rng = Rng(setupRng.Next());
+    monteCarlo.Reseed(setupRng.Next());
+    knowledgeReady = false;     // New game: forget the last opponent
+    return placed;
+}
+
+// The board size and fleet are public rules, so the AI starts from the enemy's config
+void AIPlayer::ResetKnowledge(const Grid& enemyGrid) {
+    knowledge = ShotKnowledge(enemyGrid.config);
+    knowledgeReady = true;
+}
+
+// A sunk ship is announced, so its cells stop counting as open hits
+void AIPlayer::LearnSunkShip(const Ship& ship) {
+    for (int j = 0; j < ship.size; j++) {
+        Vector2i cell = ship.Cell(j);
+        knowledge.sunk.Set(cell.y * knowledge.gridSize + cell.x);
+    }
+    if (ship.size <= MAX_SHIP_LENGTH && knowledge.remaining[ship.size] > 0)
+        knowledge.remaining[ship.size]--;
+}
+
+// Baseline strategy: any unshot cell, uniformly
+int AIPlayer::ChooseRandomCell() {
+    WideMask unshot = ~knowledge.Shot();
+    unshot.Trim(knowledge.Cells());
+    int left = unshot.Count();
+    if (left == 0) return -1;
+    return MaskSelect(unshot, rng.Below(left));
+}
+
+bool AIPlayer::Attack(Grid& enemyGrid, Vector2i* shot) {
+    if (!knowledgeReady) ResetKnowledge(enemyGrid);
+
+    int cell = -1;
+    if (mode == RANDOM_TARGETING) cell = ChooseRandomCell();
+    else if (mode == MONTE_CARLO_TARGETING) cell = monteCarlo.ChooseCell(knowledge);
+    if (cell < 0) cell = targeting.ChooseCell(knowledge);   // Exact counts never come up empty
+    if (cell < 0) return false;
+
+    Vector2i move = { cell % knowledge.gridSize, cell / knowledge.gridSize };
+    if (shot) *shot = move;
+    bool hit;
+    int sunkShip;
+    enemyGrid.Attack(move, hit, &sunkShip);
+    if (hit) {
+        knowledge.hits.Set(cell);
+        if (sunkShip != Grid::NO_SHIP) LearnSunkShip(enemyGrid.ships[sunkShip]);
+    } else {
+        knowledge.misses.Set(cell);
+    }
+    return true;
+}
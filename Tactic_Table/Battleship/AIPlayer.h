@@ -0,0 +1,30 @@
+#pragma once
+#include "Grid.h"
+#include "MonteCarloTargeting.h"
+#include "Targeting.h"
+
+enum TargetingMode { RANDOM_TARGETING, DENSITY_TARGETING, MONTE_CARLO_TARGETING };
+
+class AIPlayer {
+public:
+    Grid grid;
+    TargetingMode mode = DENSITY_TARGETING;
+    MonteCarloTargeting monteCarlo;     // Sample budget and latency are tunable here
+
+    explicit AIPlayer(const FleetConfig& config = FleetConfig()) : grid(config) {}
+
+    bool SetupShips(Rng& rng);     // Also reseeds the AI's own random choices from rng; false if the fleet did not fit
+    // Fires one shot; false only if every cell was already shot. shot (optional) receives the cell
+    bool Attack(Grid& enemyGrid, Vector2i* shot = nullptr);
+
+private:
+    DensityTargeting targeting;
+    ShotKnowledge knowledge;
+    bool knowledgeReady = false;
+    Rng rng{0x5EED};
+
+    int ChooseRandomCell();
+
+    void ResetKnowledge(const Grid& enemyGrid);
+    void LearnSunkShip(const Ship& ship);
+};
@@ -0,0 +1,43 @@
+#include "Board.h"
+#include "raylib.h"
+
+Board::Board(float offsetX, float offsetY, float span) : span(span) {
+    offset = { offsetX, offsetY };
+}
+
+void Board::Draw(const Grid& grid, bool hideShips) const {
+    int size = grid.Size();
+    float cellSize = span / size;
+
+    // Fills first, visiting only the cells that are shot or hold a ship
+    WideMask marked = hideShips ? grid.shots : grid.shots | grid.shipCells;
+    ForEachBit(marked, [&](int i) {
+        Color color;
+        if (grid.shots.Test(i)) color = grid.shipCells.Test(i) ? RED : LIGHTGRAY;
+        else color = BLUE;
+        DrawRectangleRec({ offset.x + (i % size) * cellSize, offset.y + (i / size) * cellSize,
+                           cellSize, cellSize }, color);
+    });
+
+    // Then the grid as size + 1 lines each way instead of an outline per cell; on big
+    // grids the lines would cover the cells, so only the border is drawn
+    if (cellSize < minLinedCellSize) {
+        DrawRectangleLinesEx({ offset.x - 1, offset.y - 1, span + 2, span + 2 }, 2, DARKGRAY);
+        return;
+    }
+    for (int i = 0; i <= size; ++i) {
+        DrawRectangleRec({ offset.x + i * cellSize - 1, offset.y, 2, span }, DARKGRAY);
+        DrawRectangleRec({ offset.x, offset.y + i * cellSize - 1, span, 2 }, DARKGRAY);
+    }
+}
+
+std::pair<int, int> Board::GetCellIndex(const Grid& grid, Vector2 mouse) const {
+    float cellSize = span / grid.Size();
+    float x = mouse.x - offset.x;
+    float y = mouse.y - offset.y;
+    if (x < 0 || y < 0) return { -1, -1 };
+    int c = (int)(x / cellSize);
+    int r = (int)(y / cellSize);
+    if (r >= grid.Size() || c >= grid.Size()) return { -1, -1 };
+    return { r, c };
+}
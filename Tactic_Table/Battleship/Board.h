@@ -0,0 +1,22 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "raylib.h"
+#include "Grid.h"
+#include<utility>
+#include "constants.h"
+
+// Where a grid sits on screen. Ships and shots come from the Grid passed to Draw, so the
+// rules stay the only record of the game; the cell size follows the grid's size.
+class Board {
+public:
+    Vector2 offset;                             // Screen position of the top-left corner
+    float span;                                 // Width and height of the whole grid
+
+    Board(float offsetX, float offsetY, float span = boardSpan);
+
+    void Draw(const Grid& grid, bool hideShips) const;
+    std::pair<int, int> GetCellIndex(const Grid& grid, Vector2 mouse) const;   // { -1, -1 } off the grid
+};
+
+#endif // BOARD_H
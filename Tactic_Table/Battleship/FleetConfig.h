@@ -0,0 +1,29 @@
+#pragma once
+// Board size and fleet composition for one game - no raylib dependency
+#include "WideMask.h"
+#include <vector>
+
+const int STANDARD_GRID_SIZE = 10;
+const int MAX_SHIP_LENGTH = 10;     // Longest ship any fleet may contain
+const int MAX_FLEET = 64;           // Most ships in one fleet
+
+struct FleetConfig {
+    int gridSize = STANDARD_GRID_SIZE;
+    std::vector<int> shipSizes = {5, 4, 3, 3, 2};   // Placed in this order
+
+    int Cells() const { return gridSize * gridSize; }
+    bool IsStandardGrid() const { return gridSize == STANDARD_GRID_SIZE; }
+
+    // Sizes within limits, and the ships cover at most half the board so random
+    // placement has plenty of room
+    bool IsValid() const {
+        if (gridSize < 1 || gridSize > MAX_GRID_SIZE) return false;
+        if (shipSizes.empty() || (int)shipSizes.size() > MAX_FLEET) return false;
+        int shipCells = 0;
+        for (int size : shipSizes) {
+            if (size < 1 || size > MAX_SHIP_LENGTH || size > gridSize) return false;
+            shipCells += size;
+        }
+        return shipCells * 2 <= Cells();
+    }
+};
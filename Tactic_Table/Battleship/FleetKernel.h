@@ -0,0 +1,70 @@
+#pragma once
+// Shift-based ship placement over a whole grid at once - no raylib dependency
+#include "FleetConfig.h"
+
+// Works on start masks: bit s is set when a ship can start at cell s (y * size + x)
+// and run right (across) or down. Every start is tested together with a few whole-mask
+// shifts, so the cost grows with the words in Mask rather than with the cells.
+// Instantiated with CellMask for grids up to 128 cells and WideMask beyond that;
+// FixedSize bakes the standard 10x10 geometry in so every shift is a constant.
+template <class Mask, int FixedSize = 0>
+class FleetKernel {
+public:
+    int size;
+    int cells;
+    Mask all;           // Every cell of the grid
+    Mask inner;         // Every cell except the last column: a ship can continue right
+
+    explicit FleetKernel(int gridSize = FixedSize)
+        : size(FixedSize ? FixedSize : gridSize), cells(size * size), all(MaskAll<Mask>(cells)), inner(all) {
+        Mask lastColumn = MaskEmpty<Mask>(cells);
+        for (int y = 0; y < size; y++) MaskSet(lastColumn, y * size + size - 1);
+        inner = all & ~lastColumn;
+    }
+
+    int Size() const { return FixedSize ? FixedSize : size; }
+    int Step(bool across) const { return across ? 1 : Size(); }
+
+    // Starts where a ship of this length lies entirely on free cells
+    Mask Starts(const Mask& free, int length, bool across) const {
+        if (length > Size()) return MaskEmpty<Mask>(cells);
+        Mask starts = free;
+        if (across) {
+            Mask open = free & inner;
+            for (int i = 0; i < length - 1; i++) starts = starts & (open >> i);
+            return starts & (free >> (length - 1));
+        }
+        for (int i = 1; i < length; i++) starts = starts & (free >> (i * Size()));
+        return starts;
+    }
+
+    // Superset of the starts whose ship covers at least one of the given cells;
+    // exact once intersected with Starts()
+    Mask Covering(const Mask& targets, int length, bool across) const {
+        Mask starts = targets;
+        for (int i = 1; i < length && i * Step(across) < Size() * Size(); i++) starts = starts | (targets >> (i * Step(across)));
+        return starts;
+    }
+
+    // Starts of every placement that covers one cell, up to 2 * length of them
+    int PlacementsThrough(int cell, int length, bool across, int out[]) const {
+        int x = cell % Size(), y = cell / Size();
+        int along = across ? x : y;
+        int count = 0;
+        for (int i = 0; i < length; i++) {
+            int first = along - i;
+            if (first >= 0 && first + length <= Size()) out[count++] = cell - i * Step(across);
+        }
+        return count;
+    }
+
+    bool Fits(const Mask& blocked, int start, int length, bool across) const {
+        for (int i = 0; i < length; i++)
+            if (MaskTest(blocked, start + i * Step(across))) return false;
+        return true;
+    }
+
+    void Place(Mask& mask, int start, int length, bool across) const {
+        for (int i = 0; i < length; i++) MaskSet(mask, start + i * Step(across));
+    }
+};
@@ -0,0 +1,6 @@
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+enum GameState { PLACING, PLAYING, FINISHED };
+
+#endif // GAMESTATE_H
@@ -0,0 +1,111 @@
+#include "Grid.h"
+#include "FleetKernel.h"
+
+const int PLACEMENT_ATTEMPTS = 100;     // Whole-fleet retries before giving up on a crowded config
+
+Grid::Grid(const FleetConfig& config) : config(config) {
+    Clear();
+}
+
+void Grid::Clear() {
+    ships.clear();
+    sunkCount = 0;
+    shipCells = WideMask(config.Cells());
+    shots = WideMask(config.Cells());
+    occupant.assign(config.Cells(), NO_SHIP);
+}
+
+bool Grid::CanPlace(Vector2i start, int size, bool horizontal) {
+    int n = Size();
+    for (int i = 0; i < size; i++) {
+        int x = start.x + (horizontal ? i : 0);
+        int y = start.y + (horizontal ? 0 : i);
+        if (x < 0 || y < 0 || x >= n || y >= n)
+            return false;
+        if (shipCells.Test(y * n + x))
+            return false;
+    }
+    return true;
+}
+
+// Index of a uniformly chosen start among every free placement, or -1 if none is left
+template <class Mask, int FixedSize>
+static int PickPlacement(const WideMask& shipCells, int gridSize, int size, Rng& rng, bool& across) {
+    FleetKernel<Mask, FixedSize> kernel(gridSize);
+    Mask free = kernel.all & ~MaskFrom<Mask>(shipCells);
+    Mask acrossStarts = kernel.Starts(free, size, true);
+    // A length-1 ship has the same placement both ways
+    Mask downStarts = size > 1 ? kernel.Starts(free, size, false) : MaskEmpty<Mask>(kernel.cells);
+    int acrossCount = MaskCount(acrossStarts);
+    int fits = acrossCount + MaskCount(downStarts);
+    if (fits == 0) return -1;
+
+    int pick = rng.Below(fits);
+    across = pick < acrossCount;
+    return across ? MaskSelect(acrossStarts, pick) : MaskSelect(downStarts, pick - acrossCount);
+}
+
+bool Grid::PlaceShip(int size, Rng& rng) {
+    if ((int)ships.size() >= MAX_FLEET) return false;
+
+    // Boards of up to 128 cells fit one 128-bit register
+    bool across = true;
+    int start;
+    if (config.IsStandardGrid()) start = PickPlacement<CellMask, GRID_SIZE>(shipCells, Size(), size, rng, across);
+    else if (config.Cells() <= 128) start = PickPlacement<CellMask, 0>(shipCells, Size(), size, rng, across);
+    else start = PickPlacement<WideMask, 0>(shipCells, Size(), size, rng, across);
+    if (start < 0) return false;
+
+    Ship ship;
+    ship.Initialize({ start % Size(), start / Size() }, size, across);
+    for (int i = 0; i < size; i++) {
+        Vector2i cell = ship.Cell(i);
+        int index = cell.y * Size() + cell.x;
+        shipCells.Set(index);
+        occupant[index] = (int16_t)ships.size();
+    }
+    ships.push_back(ship);
+    return true;
+}
+
+bool Grid::PlaceAllShips(Rng& rng) {
+    for (int attempt = 0; attempt < PLACEMENT_ATTEMPTS; attempt++) {
+        Clear();
+        bool placed = true;
+        for (int size : config.shipSizes) {
+            if (!PlaceShip(size, rng)) {
+                placed = false;
+                break;
+            }
+        }
+        if (placed) return true;
+    }
+    return false;
+}
+
+bool Grid::Attack(Vector2i cell, bool& hit, int* sunkShip) {
+    int x = cell.x;
+    int y = cell.y;
+    if (sunkShip) *sunkShip = NO_SHIP;
+    if (x < 0 || y < 0 || x >= Size() || y >= Size() || shots.Test(y * Size() + x)) {
+        hit = false;
+        return false;
+    }
+    int index = y * Size() + x;
+    shots.Set(index);
+    int id = occupant[index];
+    hit = id != NO_SHIP;
+    if (hit && ships[id].RegisterHit()) {
+        sunkCount++;
+        if (sunkShip) *sunkShip = id;
+    }
+    return true;
+}
+
+bool Grid::AllShipsSunk() {
+    return sunkCount == (int)ships.size();
+}
+
+bool Grid::IsCellAlreadyShot(Vector2i cell) {
+    return shots.Test(cell.y * Size() + cell.x);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "FleetConfig.h"
+#include "Rng.h"
+#include "Ship.h"
+#include <cstdint>
+#include <vector>
+
+// Any board size and fleet from FleetConfig; ship cells and shots are bitsets
+class Grid {
+public:
+    static const int GRID_SIZE = STANDARD_GRID_SIZE;    // Default board size
+    static const int NO_SHIP = -1;
+
+    FleetConfig config;
+    std::vector<Ship> ships;                // In placement order
+    int sunkCount;
+    WideMask shipCells;                     // Cells covered by some ship
+    WideMask shots;                         // Cells already fired at
+    std::vector<int16_t> occupant;          // Index into ships per cell, NO_SHIP if water
+
+    explicit Grid(const FleetConfig& config = FleetConfig());
+
+    int Size() const { return config.gridSize; }
+    bool PlaceShip(int size, Rng& rng);     // Uniform over every spot the ship still fits
+    bool PlaceAllShips(Rng& rng);           // Clears the grid and places config's whole fleet
+    bool CanPlace(Vector2i start, int size, bool horizontal);
+    // sunkShip (optional) receives the index of the ship this shot sank, or NO_SHIP
+    bool Attack(Vector2i cell, bool& hit, int* sunkShip = nullptr);
+    bool AllShipsSunk();
+    bool IsCellAlreadyShot(Vector2i cell);
+
+private:
+    void Clear();
+};
@@ -0,0 +1,300 @@
+#include "MonteCarloTargeting.h"
+#include "FleetKernel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <type_traits>
+#include <thread>
+
+static double NowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Ships still afloat, longest first
+static int RemainingShips(const ShotKnowledge& knowledge, int lengths[MAX_FLEET]) {
+    int ships = 0;
+    for (int length = MAX_SHIP_LENGTH; length >= 1; length--)
+        for (int n = 0; n < knowledge.remaining[length] && ships < MAX_FLEET; n++)
+            lengths[ships++] = length;
+    return ships;
+}
+
+// Draws one fleet layout consistent with the knowledge into occupied.
+// Every ship is drawn uniformly from the placements still valid at that point, open
+// hits first. A layout then comes up with probability 1 / (product of the choices at
+// each step), so weight * 2^exponent gets that product to undo the bias. Each layout
+// comes from exactly one sequence of draws: the ship covering the lowest uncovered hit
+// is the one placed next, and the rest follow in a fixed order. Sample returns false
+// on a dead end (no valid placement left for some ship), which counts for nothing.
+// On multi-word boards that are still mostly open, random tries stand in for building
+// the exact start masks; their hit rate is an unbiased estimate of the count.
+template <class Mask, int FixedSize>
+class KernelSampler {
+public:
+    explicit KernelSampler(const ShotKnowledge& knowledge)
+        : kernel(knowledge.gridSize),
+          blocked(MaskFrom<Mask>(knowledge.misses) | MaskFrom<Mask>(knowledge.sunk)),
+          openHits(MaskFrom<Mask>(knowledge.OpenHits())),
+          forbidden(blocked | MaskFrom<Mask>(knowledge.hits)),
+          ships(RemainingShips(knowledge, lengths)) {}
+
+    bool Sample(Rng& rng, Mask& occupied, double& weight, int& exponent) const {
+        struct Start { int cell; bool across; int ship; };
+        bool placed[MAX_FLEET] = {};
+        Start candidates[MAX_FLEET * 2 * MAX_SHIP_LENGTH];
+        occupied = MaskEmpty<Mask>(kernel.cells);
+        weight = 1;
+        exponent = 0;
+
+        // Every open hit must belong to some ship: cover the lowest uncovered one each round
+        for (Mask uncovered = openHits; MaskAny(uncovered); uncovered = openHits & ~occupied) {
+            int target = MaskSelect(uncovered, 0);
+            Mask taken = blocked | occupied;
+
+            int count = 0;
+            for (int s = 0; s < ships; s++) {
+                if (placed[s]) continue;
+                for (int d = 0; d < (lengths[s] > 1 ? 2 : 1); d++) {
+                    int starts[2 * MAX_SHIP_LENGTH];
+                    int n = kernel.PlacementsThrough(target, lengths[s], d == 0, starts);
+                    for (int i = 0; i < n; i++)
+                        if (kernel.Fits(taken, starts[i], lengths[s], d == 0))
+                            candidates[count++] = { starts[i], d == 0, s };
+                }
+            }
+            if (count == 0) return false;
+
+            const Start& pick = candidates[rng.Below(count)];
+            kernel.Place(occupied, pick.cell, lengths[pick.ship], pick.across);
+            placed[pick.ship] = true;
+            Scale(weight, exponent, count);
+        }
+
+        // The rest go anywhere that has not been shot
+        Mask taken = forbidden | occupied;
+        int takenCells = MaskCount(taken);
+        for (int s = 0; s < ships; s++) {
+            if (placed[s]) continue;
+            if (!std::is_same<Mask, CellMask>::value && takenCells * 4 < kernel.cells) {
+                int fits = PlaceByTrial(rng, taken, lengths[s], occupied);
+                if (fits == 0) return false;
+                Scale(weight, exponent, (double)Placements(lengths[s]) * fits / PLACEMENT_TRIES);
+                takenCells += lengths[s];
+                continue;
+            }
+            Mask free = kernel.all & ~taken;
+            Mask across = kernel.Starts(free, lengths[s], true);
+            Mask down = lengths[s] > 1 ? kernel.Starts(free, lengths[s], false) : MaskEmpty<Mask>(kernel.cells);
+            int acrossCount = MaskCount(across);
+            int count = acrossCount + MaskCount(down);
+            if (count == 0) return false;
+
+            int pick = rng.Below(count);
+            bool isAcross = pick < acrossCount;
+            int start = isAcross ? MaskSelect(across, pick) : MaskSelect(down, pick - acrossCount);
+            kernel.Place(taken, start, lengths[s], isAcross);
+            kernel.Place(occupied, start, lengths[s], isAcross);
+            Scale(weight, exponent, count);
+            takenCells += lengths[s];
+        }
+        return true;
+    }
+
+private:
+    static const int PLACEMENT_TRIES = 16;
+
+    // Keeps the running product in a double, moving powers of two into exponent before it overflows
+    static void Scale(double& weight, int& exponent, double factor) {
+        weight *= factor;
+        if (weight > 1e250) {
+            int shift;
+            weight = std::frexp(weight, &shift);
+            exponent += shift;
+        }
+    }
+
+    // Placements of a ship this long on an empty board
+    int Placements(int length) const {
+        int size = kernel.Size();
+        return length == 1 ? size * size : 2 * size * (size - length + 1);
+    }
+
+    // Draws PLACEMENT_TRIES placements uniformly from the empty board and places the first
+    // that fits, which is uniform over the free placements; returns how many fitted
+    int PlaceByTrial(Rng& rng, Mask& taken, int length, Mask& occupied) const {
+        int size = kernel.Size();
+        if (length > size) return 0;
+        int span = size - length + 1;
+        int fits = 0, firstStart = 0;
+        bool firstAcross = true;
+        for (int t = 0; t < PLACEMENT_TRIES; t++) {
+            bool across = length == 1 || rng.Below(2) == 0;
+            int along = rng.Below(span), other = rng.Below(size);
+            int start = across ? other * size + along : along * size + other;
+            if (!kernel.Fits(taken, start, length, across)) continue;
+            if (fits++ == 0) {
+                firstStart = start;
+                firstAcross = across;
+            }
+        }
+        if (fits > 0) {
+            kernel.Place(taken, firstStart, length, firstAcross);
+            kernel.Place(occupied, firstStart, length, firstAcross);
+        }
+        return fits;
+    }
+
+    FleetKernel<Mask, FixedSize> kernel;
+    Mask blocked, openHits, forbidden;
+    int lengths[MAX_FLEET];
+    int ships;
+};
+
+// Weighted occupancy of one worker. Weights are kept relative to 2^reference, the largest
+// exponent seen so far; on the standard board no sample needs one and this is a plain sum.
+struct WeightedCounts {
+    std::vector<double> cells;
+    double total = 0;
+    int reference = 0;
+    int fitted = 0;
+
+    double Add(double weight, int exponent) {
+        if (fitted++ == 0) reference = exponent;
+        else if (exponent > reference) Rebase(exponent);
+        if (exponent != reference) weight = std::ldexp(weight, exponent - reference);
+        total += weight;
+        return weight;
+    }
+
+    void Rebase(int newReference) {
+        for (double& cell : cells) cell = std::ldexp(cell, reference - newReference);
+        total = std::ldexp(total, reference - newReference);
+        reference = newReference;
+    }
+};
+
+// Splits the budget over the workers, each adding into its own WeightedCounts
+template <class Mask, class Sampler, class Run>
+static int DrawSamples(const Sampler& sampler, const ShotKnowledge& knowledge, int workers, int budget,
+                       double deadline, uint64_t callSeed, Run run, std::vector<double>& likelihood) {
+    int cells = knowledge.Cells();
+    Mask unshot = ~MaskFrom<Mask>(knowledge.Shot());
+    std::vector<WeightedCounts> perWorker(workers);
+
+    run(workers, [&](int w) {
+        Rng rng(callSeed + (uint64_t)w * 0xD1B54A32D192ED03ULL);
+        WeightedCounts& local = perWorker[w];
+        local.cells.assign(cells, 0.0);
+        int share = budget / workers + (w < budget % workers ? 1 : 0);
+        Mask occupied;
+        double weight;
+        int exponent;
+        for (int i = 0; i < share; i++) {
+            if ((i & 15) == 15 && NowMs() >= deadline) break;
+            if (!sampler.Sample(rng, occupied, weight, exponent)) continue;
+            weight = local.Add(weight, exponent);
+            ForEachBit(occupied & unshot, [&](int cell) { local.cells[cell] += weight; });
+        }
+    });
+
+    // Bring every worker to the largest reference before summing
+    bool any = false;
+    int reference = 0;
+    for (const WeightedCounts& local : perWorker)
+        if (local.fitted && (!any || local.reference > reference)) {
+            reference = local.reference;
+            any = true;
+        }
+    int fitted = 0;
+    double total = 0;
+    likelihood.assign(cells, 0.0);
+    for (WeightedCounts& local : perWorker) {
+        if (!local.fitted) continue;
+        local.Rebase(reference);
+        fitted += local.fitted;
+        total += local.total;
+        for (int i = 0; i < cells; i++) likelihood[i] += local.cells[i];
+    }
+    if (total > 0)
+        for (double& cell : likelihood) cell /= total;
+    return fitted;
+}
+
+MonteCarloTargeting::~MonteCarloTargeting() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        closing = true;
+    }
+    poolWake.notify_all();
+    for (std::thread& worker : pool) worker.join();
+}
+
+// Runs work(0) here and work(1..workers-1) on the pool, growing it on first use
+void MonteCarloTargeting::RunParallel(int workers, const std::function<void(int)>& work) {
+    if (workers == 1) {
+        work(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        while ((int)pool.size() < workers - 1)
+            pool.emplace_back(&MonteCarloTargeting::PoolLoop, this, (int)pool.size() + 1, jobId);
+        job = work;
+        jobWorkers = workers;
+        busy = workers - 1;
+        jobId++;
+    }
+    poolWake.notify_all();
+    work(0);
+
+    std::unique_lock<std::mutex> lock(poolMutex);
+    poolDone.wait(lock, [this]() { return busy == 0; });
+    job = nullptr;
+}
+
+// seen is the last job id before this worker existed, so it picks up the next one
+void MonteCarloTargeting::PoolLoop(int index, uint64_t seen) {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    while (true) {
+        poolWake.wait(lock, [&]() { return closing || jobId != seen; });
+        if (closing) break;
+        seen = jobId;
+        if (index >= jobWorkers) continue;
+        lock.unlock();
+        job(index);
+        lock.lock();
+        if (--busy == 0) poolDone.notify_one();
+    }
+}
+
+int MonteCarloTargeting::SampleOccupancy(const ShotKnowledge& knowledge, std::vector<double>& likelihood) {
+    int workers = threads > 0 ? threads : (int)std::max(1u, std::thread::hardware_concurrency());
+    workers = std::max(1, std::min(workers, sampleBudget));
+    double deadline = NowMs() + maxLatencyMs;
+    uint64_t callSeed = seed ^ (++calls * 0x9E3779B97F4A7C15ULL);
+    auto run = [this](int n, const std::function<void(int)>& work) { RunParallel(n, work); };
+
+    if (knowledge.gridSize == TARGET_GRID_SIZE)
+        return DrawSamples<CellMask>(KernelSampler<CellMask, TARGET_GRID_SIZE>(knowledge), knowledge, workers,
+                                     sampleBudget, deadline, callSeed, run, likelihood);
+    if (knowledge.Cells() <= 128)
+        return DrawSamples<CellMask>(KernelSampler<CellMask, 0>(knowledge), knowledge, workers, sampleBudget,
+                                     deadline, callSeed, run, likelihood);
+    return DrawSamples<WideMask>(KernelSampler<WideMask, 0>(knowledge), knowledge, workers, sampleBudget, deadline,
+                                 callSeed, run, likelihood);
+}
+
+int MonteCarloTargeting::ChooseCell(const ShotKnowledge& knowledge) {
+    std::vector<double> likelihood;
+    lastSamples = SampleOccupancy(knowledge, likelihood);
+    if (lastSamples == 0) return -1;
+
+    WideMask shot = knowledge.Shot();
+    int best = -1;
+    for (int i = 0; i < knowledge.Cells(); i++) {
+        if (shot.Test(i)) continue;
+        if (best < 0 || likelihood[i] > likelihood[best]) best = i;
+    }
+    return best;
+}
@@ -0,0 +1,58 @@
+#pragma once
+// Monte Carlo shot selection: sample whole fleets that fit the shots so far - no raylib dependency
+#include "Rng.h"
+#include "Targeting.h"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Draws complete fleet layouts consistent with every miss, hit and sunk ship, and fires
+// at the unshot cell most likely to hold a ship. Ships are placed one at a time, which
+// favours layouts with few choices along the way, so each sample is weighted by the
+// number of choices it had: the estimate is then uniform over the fleets that fit.
+// Sampling is spread over worker threads kept for the whole game, each with its own
+// seeded Rng, and always stops at the latency budget.
+// Measured with battleship_sim it does not beat DensityTargeting, which stays the
+// default: density needs about one shot fewer on the standard fleet (its hit-line
+// weighting finishes ships faster than the most likely cell) and ties on crowded boards.
+class MonteCarloTargeting {
+    public:
+        int sampleBudget = 20000;   // Total samples per shot, shared between threads
+        double maxLatencyMs = 20;   // Hard limit on time spent choosing one shot
+        int threads = 0;            // 0 = one per hardware thread
+
+        explicit MonteCarloTargeting(uint64_t seed = 0x5EED) : seed(seed) {}
+        MonteCarloTargeting(const MonteCarloTargeting&) = delete;
+        MonteCarloTargeting& operator=(const MonteCarloTargeting&) = delete;
+        ~MonteCarloTargeting();
+        void Reseed(uint64_t newSeed) { seed = newSeed; calls = 0; }
+
+        // Fills likelihood (one entry per cell) with the weighted share of samples that
+        // put a ship on the cell; returns how many samples fitted
+        int SampleOccupancy(const ShotKnowledge& knowledge, std::vector<double>& likelihood);
+        // y * size + x, or -1 if no sample fitted (the caller should fall back to density)
+        int ChooseCell(const ShotKnowledge& knowledge);
+
+        int lastSamples = 0;        // Samples behind the most recent shot
+
+    private:
+        uint64_t seed;
+        uint64_t calls = 0;         // Mixed into the seeds so successive shots differ
+
+        // Workers 1..n-1 of each shot; worker 0 is the calling thread
+        std::vector<std::thread> pool;
+        std::mutex poolMutex;
+        std::condition_variable poolWake;       // A job was posted, or the pool is closing
+        std::condition_variable poolDone;       // A worker finished its part
+        std::function<void(int)> job;
+        uint64_t jobId = 0;
+        int jobWorkers = 0;
+        int busy = 0;                           // Pool workers still on the current job
+        bool closing = false;
+
+        void RunParallel(int workers, const std::function<void(int)>& work);
+        void PoolLoop(int index, uint64_t seen);
+};
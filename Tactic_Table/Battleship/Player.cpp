@@ -0,0 +1,10 @@
+#include "Player.h"
+
+bool Player::SetupShips(Rng& rng) {
+    return grid.PlaceAllShips(rng);
+}
+
+bool Player::Attack(Grid& enemyGrid, Vector2i cell) {
+    bool hit;
+    return enemyGrid.Attack(cell, hit);
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include "Grid.h"
+
+class Player {
+public:
+    Grid grid;
+    explicit Player(const FleetConfig& config = FleetConfig()) : grid(config) {}
+    bool SetupShips(Rng& rng);      // False if the fleet did not fit
+    bool Attack(Grid& enemyGrid, Vector2i cell);
+};
+
@@ -0,0 +1,23 @@
+#pragma once
+// Small seeded PRNG (SplitMix64): one instance per thread or per game, never shared
+#include <cstdint>
+
+class Rng {
+private:
+    uint64_t state;
+
+public:
+    explicit Rng(uint64_t seed) : state(seed) {}
+
+    uint64_t Next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, n) without a division (Lemire's multiply-shift)
+    int Below(int n) {
+        return (int)(((Next() >> 32) * (uint64_t)n) >> 32);
+    }
+};
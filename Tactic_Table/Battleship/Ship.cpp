@@ -0,0 +1,23 @@
+#include "Ship.h"
+
+Ship::Ship() : start{ 0, 0 }, size(0), horizontal(true), hits(0) {}
+
+void Ship::Initialize(Vector2i start, int size, bool horizontal) {
+    this->start = start;
+    this->size = size;
+    this->horizontal = horizontal;
+    this->hits = 0;
+}
+
+Vector2i Ship::Cell(int i) const {
+    return { start.x + (horizontal ? i : 0), start.y + (horizontal ? 0 : i) };
+}
+
+bool Ship::RegisterHit() {
+    hits++;
+    return hits == size;
+}
+
+bool Ship::IsSunk() const {
+    return hits >= size;
+}
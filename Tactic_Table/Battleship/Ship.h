@@ -0,0 +1,17 @@
+#pragma once
+#include "Vector2i.h"
+
+// Stored as start, length and direction so ships can be any length
+class Ship {
+public:
+    Vector2i start;     // Top-left cell (x = column, y = row)
+    int size;
+    bool horizontal;
+    int hits;
+
+    Ship();
+    void Initialize(Vector2i start, int size, bool horizontal);
+    Vector2i Cell(int i) const;     // i-th cell from the start, 0 <= i < size
+    bool RegisterHit();     // Returns true if this hit sank the ship
+    bool IsSunk() const;
+};
@@ -0,0 +1,62 @@
+#include "Targeting.h"
+#include "FleetKernel.h"
+
+// The valid starts of each length and direction come out of a few shifts, then only
+// the placements that fit are walked
+template <class Mask, int FixedSize>
+static void KernelDensity(const ShotKnowledge& knowledge, int* density) {
+    FleetKernel<Mask, FixedSize> kernel(knowledge.gridSize);
+    Mask blocked = MaskFrom<Mask>(knowledge.misses) | MaskFrom<Mask>(knowledge.sunk);
+    Mask openHits = MaskFrom<Mask>(knowledge.OpenHits());
+    Mask free = kernel.all & ~blocked;
+    bool anyOpen = MaskAny(openHits);
+
+    for (int length = 1; length <= MAX_SHIP_LENGTH; length++) {
+        int ships = knowledge.remaining[length];
+        if (ships == 0) continue;
+
+        for (int d = 0; d < (length > 1 ? 2 : 1); d++) {
+            bool across = d == 0;
+            int step = kernel.Step(across);
+            Mask starts = kernel.Starts(free, length, across);
+
+            if (anyOpen) {
+                Mask touching = starts & kernel.Covering(openHits, length, across);
+                starts = starts & ~touching;
+                ForEachBit(touching, [&](int start) {
+                    int covered = 0;
+                    for (int i = 0; i < length; i++) covered += MaskTest(openHits, start + i * step);
+                    int weight = ships * covered * DensityTargeting::TARGET_WEIGHT;
+                    for (int i = 0; i < length; i++) {
+                        int cell = start + i * step;
+                        if (!MaskTest(openHits, cell)) density[cell] += weight;
+                    }
+                });
+            }
+            // Placements touching no open hit lie on unshot cells only
+            ForEachBit(starts, [&](int start) {
+                for (int i = 0; i < length; i++) density[start + i * step] += ships;
+            });
+        }
+    }
+}
+
+void DensityTargeting::ComputeDensity(const ShotKnowledge& knowledge, std::vector<int>& density) const {
+    density.assign(knowledge.Cells(), 0);
+    if (knowledge.gridSize == TARGET_GRID_SIZE) KernelDensity<CellMask, TARGET_GRID_SIZE>(knowledge, density.data());
+    else if (knowledge.Cells() <= 128) KernelDensity<CellMask, 0>(knowledge, density.data());
+    else KernelDensity<WideMask, 0>(knowledge, density.data());
+}
+
+int DensityTargeting::ChooseCell(const ShotKnowledge& knowledge) {
+    ComputeDensity(knowledge, density);
+
+    WideMask shot = knowledge.Shot();
+    int best = -1;
+    for (int i = 0; i < knowledge.Cells(); i++) {
+        if (shot.Test(i)) continue;
+        // Unshot cells with zero density still beat passing the turn
+        if (best < 0 || density[i] > density[best]) best = i;
+    }
+    return best;
+}
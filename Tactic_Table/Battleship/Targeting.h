@@ -0,0 +1,45 @@
+#pragma once
+// Probability-density shot selection for the AI - no raylib dependency
+#include "FleetConfig.h"
+#include <cstdint>
+#include <vector>
+
+// Standard 10x10 grid, bit index = y * TARGET_GRID_SIZE + x
+const int TARGET_GRID_SIZE = STANDARD_GRID_SIZE;
+const int TARGET_CELLS = TARGET_GRID_SIZE * TARGET_GRID_SIZE;
+
+// Everything the shooter has learned about the enemy grid, for any board size
+struct ShotKnowledge {
+    int gridSize = TARGET_GRID_SIZE;
+    WideMask misses;
+    WideMask hits;                              // Every hit, including cells of sunk ships
+    WideMask sunk;                              // Cells of ships reported sunk
+    int remaining[MAX_SHIP_LENGTH + 1] = {};    // Unsunk ships by length
+
+    ShotKnowledge() : ShotKnowledge(FleetConfig()) {}
+    explicit ShotKnowledge(const FleetConfig& config)
+        : gridSize(config.gridSize), misses(config.Cells()), hits(config.Cells()), sunk(config.Cells()) {
+        for (int size : config.shipSizes) remaining[size]++;
+    }
+
+    int Cells() const { return gridSize * gridSize; }
+    WideMask Shot() const { return misses | hits; }
+    WideMask OpenHits() const { return hits & ~sunk; }     // Hits on ships still afloat
+};
+
+// Counts, for every unshot cell, how many placements of the remaining ships fit what
+// is known. Placements covering open hits get a large weight, so the same count
+// drives both hunting (no open hits) and finishing off a damaged ship.
+// Runs on the shift-based FleetKernel: 128-bit masks with the geometry fixed at compile
+// time for the standard grid, 128-bit masks up to 128 cells, and WideMask beyond.
+class DensityTargeting {
+    public:
+        static const int TARGET_WEIGHT = 64;    // Weight per open hit a placement covers
+
+        // Fills density with one entry per cell of the knowledge's grid
+        void ComputeDensity(const ShotKnowledge& knowledge, std::vector<int>& density) const;
+        int ChooseCell(const ShotKnowledge& knowledge);    // y * size + x, or -1 if all shot
+
+    private:
+        std::vector<int> density;               // Reused between shots
+};
@@ -0,0 +1,134 @@
+#pragma once
+// Multi-word cell bitsets for grids beyond 10x10 - no raylib dependency
+#include <cstdint>
+
+typedef unsigned __int128 CellMask;    // One bit per cell while the grid has at most 128 cells
+
+const int MAX_GRID_SIZE = 128;
+const int MAX_MASK_WORDS = (MAX_GRID_SIZE * MAX_GRID_SIZE + 63) / 64;
+
+// Fixed-capacity bitset where only the first `words` words are live, so every
+// operation costs one pass over the cells actually in use. Bits past the last cell
+// are not kept clear by ~ and shifts: mask with the grid's full set where it matters.
+class WideMask {
+public:
+    int words = 0;
+    uint64_t w[MAX_MASK_WORDS];
+
+    WideMask() {}
+    explicit WideMask(int cells) : words((cells + 63) / 64) { Clear(); }
+    WideMask(const WideMask& other) : words(other.words) { Copy(other); }
+    WideMask& operator=(const WideMask& other) {
+        words = other.words;
+        Copy(other);
+        return *this;
+    }
+
+    void Clear() { for (int i = 0; i < words; i++) w[i] = 0; }
+    bool Test(int bit) const { return (w[bit >> 6] >> (bit & 63)) & 1; }
+    void Set(int bit) { w[bit >> 6] |= 1ULL << (bit & 63); }
+    // Clears the unused bits past the last cell
+    void Trim(int cells) {
+        if (cells & 63) w[words - 1] &= (1ULL << (cells & 63)) - 1;
+    }
+
+    bool Any() const {
+        for (int i = 0; i < words; i++) if (w[i]) return true;
+        return false;
+    }
+    int Count() const {
+        int n = 0;
+        for (int i = 0; i < words; i++) n += __builtin_popcountll(w[i]);
+        return n;
+    }
+
+    WideMask& operator&=(const WideMask& o) { for (int i = 0; i < words; i++) w[i] &= o.w[i]; return *this; }
+    WideMask& operator|=(const WideMask& o) { for (int i = 0; i < words; i++) w[i] |= o.w[i]; return *this; }
+    WideMask operator&(const WideMask& o) const { WideMask r(*this); return r &= o; }
+    WideMask operator|(const WideMask& o) const { WideMask r(*this); return r |= o; }
+    WideMask operator~() const {
+        WideMask r(*this);
+        for (int i = 0; i < words; i++) r.w[i] = ~w[i];
+        return r;
+    }
+
+    // Bit i of the result is bit i + n of this mask
+    WideMask operator>>(int n) const {
+        WideMask r;
+        r.words = words;
+        int skip = n >> 6, bits = n & 63;
+        for (int i = 0; i < words; i++) {
+            uint64_t lo = i + skip < words ? w[i + skip] : 0;
+            uint64_t hi = i + skip + 1 < words ? w[i + skip + 1] : 0;
+            r.w[i] = bits ? (lo >> bits) | (hi << (64 - bits)) : lo;
+        }
+        return r;
+    }
+
+private:
+    void Copy(const WideMask& other) { for (int i = 0; i < words; i++) w[i] = other.w[i]; }
+};
+
+// The same small vocabulary over both representations, so kernels can be written once
+inline bool MaskTest(CellMask m, int bit) { return (m >> bit) & 1; }
+inline bool MaskTest(const WideMask& m, int bit) { return m.Test(bit); }
+inline void MaskSet(CellMask& m, int bit) { m |= (CellMask)1 << bit; }
+inline void MaskSet(WideMask& m, int bit) { m.Set(bit); }
+inline bool MaskAny(CellMask m) { return m != 0; }
+inline bool MaskAny(const WideMask& m) { return m.Any(); }
+inline int MaskCount(CellMask m) {
+    return __builtin_popcountll((uint64_t)m) + __builtin_popcountll((uint64_t)(m >> 64));
+}
+inline int MaskCount(const WideMask& m) { return m.Count(); }
+
+template <class Visit>
+void ForEachBit(CellMask m, Visit visit) {
+    for (uint64_t low = (uint64_t)m; low; low &= low - 1) visit(__builtin_ctzll(low));
+    for (uint64_t high = (uint64_t)(m >> 64); high; high &= high - 1) visit(64 + __builtin_ctzll(high));
+}
+template <class Visit>
+void ForEachBit(const WideMask& m, Visit visit) {
+    for (int i = 0; i < m.words; i++)
+        for (uint64_t word = m.w[i]; word; word &= word - 1) visit(i * 64 + __builtin_ctzll(word));
+}
+
+// Index of the k-th set bit (k counted from 0), or -1 if there are not that many
+inline int SelectInWord(uint64_t word, int k) {
+    for (; k > 0; k--) word &= word - 1;
+    return word ? __builtin_ctzll(word) : -1;
+}
+inline int MaskSelect(CellMask m, int k) {
+    int low = __builtin_popcountll((uint64_t)m);
+    if (k < low) return SelectInWord((uint64_t)m, k);
+    int bit = SelectInWord((uint64_t)(m >> 64), k - low);
+    return bit < 0 ? -1 : 64 + bit;
+}
+inline int MaskSelect(const WideMask& m, int k) {
+    for (int i = 0; i < m.words; i++) {
+        int n = __builtin_popcountll(m.w[i]);
+        if (k < n) return i * 64 + SelectInWord(m.w[i], k);
+        k -= n;
+    }
+    return -1;
+}
+
+// Conversions at the boundary between WideMask storage and a kernel's own mask type
+template <class Mask> Mask MaskFrom(const WideMask& m);
+template <> inline WideMask MaskFrom<WideMask>(const WideMask& m) { return m; }
+template <> inline CellMask MaskFrom<CellMask>(const WideMask& m) {
+    CellMask r = m.words > 0 ? m.w[0] : 0;
+    if (m.words > 1) r |= (CellMask)m.w[1] << 64;
+    return r;
+}
+template <class Mask> Mask MaskEmpty(int cells);
+template <> inline CellMask MaskEmpty<CellMask>(int) { return 0; }
+template <> inline WideMask MaskEmpty<WideMask>(int cells) { return WideMask(cells); }
+template <class Mask> Mask MaskAll(int cells);
+template <> inline CellMask MaskAll<CellMask>(int cells) {
+    return cells >= 128 ? ~(CellMask)0 : ((CellMask)1 << cells) - 1;
+}
+template <> inline WideMask MaskAll<WideMask>(int cells) {
+    WideMask r = ~WideMask(cells);
+    r.Trim(cells);
+    return r;
+}
@@ -0,0 +1,302 @@
+// Headless AI-vs-AI Battleship simulator for tuning targeting strategies offline
+//
+//   battleship_sim [--games N] [--threads T] [--seed S] [--strategies a,b,...]
+//                  [--grid SIZE] [--fleet 5,4,3x2,2] [--mc-samples N] [--csv FILE]
+//
+// Strategies: random, density, montecarlo. --fleet lists ship lengths, LxN meaning N
+// ships of length L; the default is the standard 10x10 grid with 5,4,3,3,2. Every pairing (including self-play) plays
+// N games. Game i is seeded from (seed, i) alone, so results do not depend on the
+// thread count or scheduling. Shots never interact between the two sides, so each AI
+// sinks the other's fleet independently and the one needing fewer shots wins (the
+// first player wins ties, as it would have fired first).
+//
+// Build: cmake target battleship_sim, or g++ -O2 -std=c++17 -pthread AIPlayer.cpp Grid.cpp Ship.cpp
+//        Targeting.cpp MonteCarloTargeting.cpp battleship_sim.cpp -o battleship_sim
+
+#include "AIPlayer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+const int CHUNK = 64;   // Games a worker claims at a time
+
+struct Strategy {
+    const char* name;
+    TargetingMode mode;
+};
+
+static const Strategy STRATEGIES[] = {
+    {"random", RANDOM_TARGETING},
+    {"density", DENSITY_TARGETING},
+    {"montecarlo", MONTE_CARLO_TARGETING},
+};
+
+// Per-strategy shot counts plus the head-to-head tally of one pairing
+struct MatchStats {
+    std::vector<uint64_t> shotsHistogram[2];    // [side][shots to sink the fleet]
+    uint64_t wins[2] = {};
+    uint64_t skipped = 0;                       // Games where a fleet could not be placed
+
+    explicit MatchStats(int maxShots) {
+        for (int s = 0; s < 2; s++) shotsHistogram[s].assign(maxShots + 1, 0);
+    }
+
+    void Merge(const MatchStats& other) {
+        skipped += other.skipped;
+        for (int s = 0; s < 2; s++) {
+            wins[s] += other.wins[s];
+            for (size_t i = 0; i < shotsHistogram[s].size(); i++) shotsHistogram[s][i] += other.shotsHistogram[s][i];
+        }
+    }
+};
+
+struct Summary {
+    uint64_t games = 0;
+    double mean = 0, stddev = 0;
+    int minShots = 0, p10 = 0, p50 = 0, p90 = 0, maxShots = 0;
+};
+
+static Summary Summarise(const uint64_t* histogram, int maxShots) {
+    Summary s;
+    double sum = 0, sumSq = 0;
+    for (int i = 0; i <= maxShots; i++) {
+        s.games += histogram[i];
+        sum += (double)histogram[i] * i;
+        sumSq += (double)histogram[i] * i * i;
+    }
+    if (s.games == 0) return s;
+    s.mean = sum / s.games;
+    s.stddev = std::sqrt(std::max(0.0, sumSq / s.games - s.mean * s.mean));
+
+    // Nearest-rank percentiles: the first value whose cumulative count reaches the rank
+    uint64_t rank10 = std::max<uint64_t>(1, (s.games * 10 + 99) / 100);
+    uint64_t rank50 = std::max<uint64_t>(1, (s.games * 50 + 99) / 100);
+    uint64_t rank90 = std::max<uint64_t>(1, (s.games * 90 + 99) / 100);
+    uint64_t seen = 0;
+    bool haveMin = false;
+    for (int i = 0; i <= maxShots; i++) {
+        if (histogram[i] == 0) continue;
+        if (!haveMin) { s.minShots = i; haveMin = true; }
+        s.maxShots = i;
+        uint64_t before = seen;
+        seen += histogram[i];
+        if (before < rank10 && seen >= rank10) s.p10 = i;
+        if (before < rank50 && seen >= rank50) s.p50 = i;
+        if (before < rank90 && seen >= rank90) s.p90 = i;
+    }
+    return s;
+}
+
+static uint64_t GameSeed(uint64_t seed, uint64_t game) {
+    Rng mix(seed ^ (game * 0x9E3779B97F4A7C15ULL));
+    return mix.Next();
+}
+
+// Shots one AI needs to sink every ship of the given fleet
+static int ShotsToSink(AIPlayer& shooter, Grid& fleet) {
+    int shots = 0;
+    while (!fleet.AllShipsSunk() && shots < fleet.config.Cells()) {
+        if (!shooter.Attack(fleet)) break;
+        shots++;
+    }
+    return shots;
+}
+
+static void PlayGame(const FleetConfig& config, const Strategy& a, const Strategy& b, uint64_t seed, int mcSamples,
+                     MatchStats& stats) {
+    Rng rng(seed);
+    AIPlayer players[2] = { AIPlayer(config), AIPlayer(config) };
+    bool placed = true;
+    players[0].mode = a.mode;
+    players[1].mode = b.mode;
+    for (AIPlayer& p : players) {
+        // Single-threaded sampling with no deadline keeps Monte Carlo games reproducible
+        p.monteCarlo.threads = 1;
+        p.monteCarlo.sampleBudget = mcSamples;
+        p.monteCarlo.maxLatencyMs = 1e9;
+        placed = p.SetupShips(rng) && placed;
+    }
+    // A partial fleet would need fewer shots and skew the histograms
+    if (!placed) {
+        stats.skipped++;
+        return;
+    }
+
+    int shots[2];
+    shots[0] = ShotsToSink(players[0], players[1].grid);
+    shots[1] = ShotsToSink(players[1], players[0].grid);
+    stats.shotsHistogram[0][shots[0]]++;
+    stats.shotsHistogram[1][shots[1]]++;
+    stats.wins[shots[0] <= shots[1] ? 0 : 1]++;
+}
+
+// Fast pairings in games per second, slow ones (big boards) in seconds per game
+static std::string RateText(uint64_t games, double seconds) {
+    double rate = games / seconds;
+    char text[64];
+    if (rate >= 1000) snprintf(text, sizeof(text), "%.0f games/s (%.2f M games/min)", rate, rate * 60 / 1e6);
+    else if (rate >= 1) snprintf(text, sizeof(text), "%.2f games/s", rate);
+    else snprintf(text, sizeof(text), "%.2f s/game", 1 / rate);
+    return text;
+}
+
+// "5,4,3x2,2" -> 5 4 3 3 2; false on anything malformed
+static bool ParseFleet(const std::string& text, std::vector<int>& sizes) {
+    sizes.clear();
+    std::stringstream items(text);
+    for (std::string item; std::getline(items, item, ',');) {
+        int length = 0, count = 1;
+        char extra;
+        if (sscanf(item.c_str(), "%dx%d%c", &length, &count, &extra) == 2 ||
+            sscanf(item.c_str(), "%d%c", &length, &extra) == 1) {
+            for (int i = 0; i < count; i++) sizes.push_back(length);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint64_t games = 100000;
+    int threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    uint64_t seed = 1;
+    int mcSamples = 500;
+    std::string strategyList = "random,density";
+    std::string csvPath;
+    FleetConfig config;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--games") && i + 1 < argc) games = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--strategies") && i + 1 < argc) strategyList = argv[++i];
+        else if (!strcmp(argv[i], "--mc-samples") && i + 1 < argc) mcSamples = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--csv") && i + 1 < argc) csvPath = argv[++i];
+        else if (!strcmp(argv[i], "--grid") && i + 1 < argc) config.gridSize = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--fleet") && i + 1 < argc && ParseFleet(argv[i + 1], config.shipSizes)) i++;
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--games N] [--threads T] [--seed S]"
+                      << " [--strategies random,density,montecarlo] [--grid SIZE] [--fleet 5,4,3x2,2]"
+                      << " [--mc-samples N] [--csv FILE]\n";
+            return 2;
+        }
+    }
+    if (!config.IsValid()) {
+        std::cerr << "Unsupported grid/fleet: grid 1-" << MAX_GRID_SIZE << ", at most " << MAX_FLEET
+                  << " ships of length 1-" << MAX_SHIP_LENGTH << " covering at most half the grid\n";
+        return 2;
+    }
+    const int maxShots = config.Cells();
+
+    std::vector<Strategy> chosen;
+    std::stringstream names(strategyList);
+    for (std::string name; std::getline(names, name, ',');) {
+        bool found = false;
+        for (const Strategy& s : STRATEGIES) {
+            if (name == s.name) {
+                chosen.push_back(s);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "Unknown strategy '" << name << "'\n";
+            return 2;
+        }
+    }
+
+    std::ofstream csv;
+    if (!csvPath.empty()) {
+        csv.open(csvPath);
+        if (!csv) {
+            std::cerr << "Cannot open " << csvPath << " for writing\n";
+            return 2;
+        }
+        csv << "first,second,side,strategy,shots,games\n";
+    }
+
+    printf("%dx%d grid, %d ships, %llu games per pairing, %d threads, seed %llu\n\n", config.gridSize,
+           config.gridSize, (int)config.shipSizes.size(), (unsigned long long)games, threads,
+           (unsigned long long)seed);
+
+    std::vector<uint64_t> strategyHistogram(chosen.size() * (maxShots + 1), 0);
+
+    for (size_t ia = 0; ia < chosen.size(); ia++) {
+        for (size_t ib = ia; ib < chosen.size(); ib++) {
+            const Strategy& a = chosen[ia];
+            const Strategy& b = chosen[ib];
+            uint64_t pairingSeed = seed * 1000003ULL + ia * 31 + ib;
+
+            std::atomic<uint64_t> nextGame{0};
+            std::vector<MatchStats> perThread(threads, MatchStats(maxShots));
+            auto start = std::chrono::steady_clock::now();
+            auto work = [&](int t) {
+                for (;;) {
+                    uint64_t first = nextGame.fetch_add(CHUNK);
+                    if (first >= games) break;
+                    uint64_t last = std::min(games, first + CHUNK);
+                    for (uint64_t g = first; g < last; g++)
+                        PlayGame(config, a, b, GameSeed(pairingSeed, g), mcSamples, perThread[t]);
+                }
+            };
+            std::vector<std::thread> pool;
+            for (int t = 0; t < threads; t++) pool.emplace_back(work, t);
+            for (std::thread& th : pool) th.join();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            MatchStats total(maxShots);
+            for (const MatchStats& s : perThread) total.Merge(s);
+
+            printf("%s vs %s: %s\n", a.name, b.name, RateText(games, seconds).c_str());
+            uint64_t played = games - total.skipped;
+            if (total.skipped)
+                printf("  %llu games skipped: a fleet could not be placed\n", (unsigned long long)total.skipped);
+            if (played)
+                printf("  %-10s wins %6.2f%%   %-10s wins %6.2f%%\n", a.name, 100.0 * total.wins[0] / played, b.name,
+                       100.0 * total.wins[1] / played);
+            for (int side = 0; side < 2; side++) {
+                const Strategy& s = side == 0 ? a : b;
+                Summary sum = Summarise(total.shotsHistogram[side].data(), maxShots);
+                printf("  %-10s shots to win: mean %5.2f  sd %5.2f  min %3d  p10 %3d  median %3d  p90 %3d  max %3d\n",
+                       s.name, sum.mean, sum.stddev, sum.minShots, sum.p10, sum.p50, sum.p90, sum.maxShots);
+
+                size_t index = side == 0 ? ia : ib;
+                for (int i = 0; i <= maxShots; i++) {
+                    strategyHistogram[index * (maxShots + 1) + i] += total.shotsHistogram[side][i];
+                    if (csv && total.shotsHistogram[side][i])
+                        csv << a.name << "," << b.name << "," << side << "," << s.name << "," << i << ","
+                            << total.shotsHistogram[side][i] << "\n";
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    // Shots-to-win distribution per strategy over every game it played, about 20 bins wide
+    int binWidth = std::max(5, maxShots / 20);
+    printf("Shots-to-win distribution (all pairings)\n");
+    for (size_t i = 0; i < chosen.size(); i++) {
+        const uint64_t* histogram = &strategyHistogram[i * (maxShots + 1)];
+        Summary sum = Summarise(histogram, maxShots);
+        printf("  %s (%llu fleets, mean %.2f)\n", chosen[i].name, (unsigned long long)sum.games, sum.mean);
+        for (int lo = 0; lo <= maxShots; lo += binWidth) {
+            uint64_t bin = 0;
+            for (int s = lo; s < lo + binWidth && s <= maxShots; s++) bin += histogram[s];
+            if (bin == 0) continue;
+            int bar = (int)(60.0 * bin / sum.games + 0.5);
+            printf("    %5d-%5d %6.2f%% %s\n", lo, std::min(lo + binWidth - 1, maxShots), 100.0 * bin / sum.games,
+                   std::string(bar, '#').c_str());
+        }
+    }
+    return 0;
+}
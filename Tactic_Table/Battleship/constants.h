@@ -0,0 +1,7 @@
+#ifndef CONSTANTS_H
+#define CONSTANTS_H
+
+const float boardSpan = 400.0f;         // On-screen width of a whole board in pixels
+const float minLinedCellSize = 8.0f;    // Smaller cells get no grid lines between them
+
+#endif // CONSTANTS_H
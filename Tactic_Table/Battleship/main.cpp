@@ -0,0 +1,117 @@
+#include "raylib.h"
+#include "AIPlayer.h"
+#include "Board.h"
+#include "GameState.h"
+#include "Player.h"
+#include "ResourceCache.h"
+#include "FramePacer.h"
+#include <ctime>
+
+const int SCREEN_WIDTH = 900;
+const int SCREEN_HEIGHT = 560;
+const float BOARD_TOP = 100.0f;
+const float PLAYER_BOARD_LEFT = 40.0f;
+const float ENEMY_BOARD_LEFT = 460.0f;
+const float AI_DELAY = 0.5f;    // Seconds before the computer fires back
+
+int main() {
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Battleship");
+    InitAudioDevice();
+    SetTargetFPS(60);
+
+    ResourceCache resources;
+    SoundHandle hitSound = resources.RequestSound("resources/battleship/hit.wav");
+    SoundHandle missSound = resources.RequestSound("resources/battleship/miss.wav");
+    SoundHandle sunkSound = resources.RequestSound("resources/battleship/sunk.wav");
+    resources.StartLoading();
+    FramePacer pacer;
+
+    // Sunk beats hit beats miss
+    auto playShot = [&](const Grid& grid, int sunkBefore, Vector2i cell) {
+        if (grid.sunkCount > sunkBefore) resources.Play(sunkSound);
+        else resources.Play(grid.shipCells.Test(cell.y * grid.Size() + cell.x) ? hitSound : missSound);
+    };
+
+    Rng rng((uint64_t)time(nullptr));
+    Player human;
+    AIPlayer ai;
+    const Board playerBoard(PLAYER_BOARD_LEFT, BOARD_TOP);    // Screen positions only; the grids hold the game
+    const Board enemyBoard(ENEMY_BOARD_LEFT, BOARD_TOP);
+    GameState state = PLACING;
+    bool humanTurn = true;
+    bool humanWon = false;
+    float aiTimer = 0;
+
+    auto newGame = [&]() {
+        human.SetupShips(rng);
+        ai.SetupShips(rng);
+        humanTurn = true;
+        aiTimer = 0;
+        state = PLACING;
+    };
+    newGame();
+
+    while (!WindowShouldClose()) {
+        resources.Update();
+        if (state == PLACING) {
+            if (IsKeyPressed(KEY_R)) newGame();
+            if (IsKeyPressed(KEY_ENTER)) state = PLAYING;
+        } else if (state == PLAYING) {
+            if (humanTurn) {
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                    std::pair<int, int> cell = enemyBoard.GetCellIndex(ai.grid, GetMousePosition());
+                    Vector2i target = { cell.second, cell.first };
+                    if (cell.first >= 0 && !ai.grid.IsCellAlreadyShot(target)) {
+                        int sunkBefore = ai.grid.sunkCount;
+                        human.Attack(ai.grid, target);
+                        playShot(ai.grid, sunkBefore, target);
+                        if (ai.grid.AllShipsSunk()) {
+                            humanWon = true;
+                            state = FINISHED;
+                        }
+                        humanTurn = false;
+                    }
+                }
+            } else {
+                aiTimer += FramePacer::FrameTime();
+                if (aiTimer >= AI_DELAY) {
+                    Vector2i shot;
+                    int sunkBefore = human.grid.sunkCount;
+                    if (ai.Attack(human.grid, &shot)) playShot(human.grid, sunkBefore, shot);
+                    if (human.grid.AllShipsSunk()) {
+                        humanWon = false;
+                        state = FINISHED;
+                    }
+                    humanTurn = true;
+                    aiTimer = 0;
+                }
+            }
+        } else if (state == FINISHED) {
+            if (IsKeyPressed(KEY_ENTER)) newGame();
+        }
+
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+
+        DrawText("Your Fleet", (int)PLAYER_BOARD_LEFT, (int)BOARD_TOP - 30, 20, DARKBLUE);
+        DrawText("Enemy Waters", (int)ENEMY_BOARD_LEFT, (int)BOARD_TOP - 30, 20, MAROON);
+        playerBoard.Draw(human.grid, false);
+        enemyBoard.Draw(ai.grid, state != FINISHED);    // Reveal the enemy fleet once the game ends
+
+        const char* message = "";
+        if (state == PLACING) message = "R: reshuffle your fleet   ENTER: start";
+        else if (state == PLAYING) message = humanTurn ? "Your turn: fire at the enemy grid" : "Computer is aiming...";
+        else message = humanWon ? "You Won! ENTER to play again" : "Computer Won! ENTER to play again";
+        DrawText(message, (int)PLAYER_BOARD_LEFT, 20, 24, BLACK);
+
+        // Only the computer's delayed shot changes the screen without input
+        bool waiting = (state == PLAYING && !humanTurn) || !resources.IsReady();
+        pacer.Set(waiting ? FRAME_WAITING : FRAME_IDLE);
+        EndDrawing();
+    }
+
+    resources.Unload();
+    CloseAudioDevice();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,278 @@
+// Micro-benchmarks for the hot kernels of all three games (Google Benchmark)
+//
+//   micro_benchmarks [--benchmark_filter=REGEX] [--benchmark_format=console|json|csv]
+//
+// Every benchmark runs on fixed, seeded positions so numbers are comparable between
+// builds: measure before and after a performance change with the same filter.
+//
+// Build: cmake target micro_benchmarks (only configured when Google Benchmark is found)
+
+#include "CheckersEngine.h"
+#include "OthelloEngine.h"
+#include "OthelloVariants.h"
+#include "AIPlayer.h"
+#include "MonteCarloTargeting.h"
+#include "Targeting.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// --- Checkers ---
+
+static const char* CHECKERS_POSITIONS[] = {
+    "h:aaaaaaaaaaaa........hhhhhhhhhhhh",     // Start
+    "h:a.aaaa.a..a..aa.....ah.hhh.ahhhh",     // Middlegame
+    "h:..aaa...H..a.h.a...h....hh.hh.hh",     // Kings
+};
+
+static checkers::Position CheckersPosition(int index) {
+    checkers::Position pos;
+    checkers::FromString(CHECKERS_POSITIONS[index], pos);
+    return pos;
+}
+
+static void BM_CheckersGenerateMoves(benchmark::State& state) {
+    checkers::Position pos = CheckersPosition((int)state.range(0));
+    checkers::MoveList list;
+    for (auto _ : state) {
+        checkers::GenerateMoves(pos, list);
+        benchmark::DoNotOptimize(list.count);
+    }
+}
+BENCHMARK(BM_CheckersGenerateMoves)->DenseRange(0, 2);
+
+static void BM_CheckersEvaluate(benchmark::State& state) {
+    checkers::Position pos = CheckersPosition((int)state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(checkers::Evaluate(pos));
+}
+BENCHMARK(BM_CheckersEvaluate)->DenseRange(0, 2);
+
+static void BM_CheckersPerft(benchmark::State& state) {
+    checkers::Position pos = checkers::StartPosition();
+    uint64_t nodes = 0;
+    for (auto _ : state) nodes += checkers::Perft(pos, (int)state.range(0));
+    state.counters["nodes/s"] = benchmark::Counter((double)nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CheckersPerft)->Arg(6)->Unit(benchmark::kMillisecond);
+
+static void BM_CheckersSearch(benchmark::State& state) {
+    checkers::Position pos = CheckersPosition(1);
+    checkers::Searcher searcher;
+    checkers::SearchLimits limits;
+    limits.maxDepth = (int)state.range(0);
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        searcher.ClearTable();      // Each iteration searches from a cold table
+        nodes += searcher.Search(pos, limits).nodes;
+    }
+    state.counters["nodes/s"] = benchmark::Counter((double)nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CheckersSearch)->Arg(8)->Arg(10)->Unit(benchmark::kMillisecond);
+
+// --- Othello ---
+
+static const char* OTHELLO_POSITIONS[] = {
+    // Start
+    "b:...........................WB......BW...........................",
+    // Middlegame, 26 discs (seeded random playout)
+    "b:.B...B....BWBW....WB.....WWWBW..W.BWBB.....BBWWW....BB.B........",
+    // Endgame, 14 empty squares
+    "b:..W...W.W.WBBBBB.WBBBWWW.BBWBW...BWBBWBBBBWBWWBWBWWWBWB.B.WWWWWW",
+};
+
+static othello::Position OthelloPosition(int index) {
+    othello::Position pos;
+    othello::FromString(OTHELLO_POSITIONS[index], pos);
+    return pos;
+}
+
+static void BM_OthelloLegalMoves(benchmark::State& state) {
+    othello::Position pos = OthelloPosition((int)state.range(0));
+    int side = pos.sideToMove;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pos.discs[side]);
+        benchmark::DoNotOptimize(othello::LegalMoves(pos.discs[side], pos.discs[side ^ 1]));
+    }
+}
+BENCHMARK(BM_OthelloLegalMoves)->DenseRange(0, 2);
+
+static void BM_OthelloMakeMove(benchmark::State& state) {
+    othello::Position pos = OthelloPosition((int)state.range(0));
+    othello::MoveList list;
+    othello::GenerateMoves(pos, list);
+    for (auto _ : state)
+        for (int i = 0; i < list.count; ++i) benchmark::DoNotOptimize(othello::MakeMove(pos, list.moves[i]));
+    state.SetItemsProcessed(state.iterations() * list.count);
+}
+BENCHMARK(BM_OthelloMakeMove)->DenseRange(0, 2);
+
+static void BM_OthelloEvaluate(benchmark::State& state) {
+    othello::Position pos = OthelloPosition((int)state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pos.discs[0]);
+        benchmark::DoNotOptimize(othello::Evaluate(pos));
+    }
+}
+BENCHMARK(BM_OthelloEvaluate)->DenseRange(0, 2);
+
+static void BM_OthelloPerft(benchmark::State& state) {
+    othello::Position pos = othello::StartPosition();
+    uint64_t nodes = 0;
+    for (auto _ : state) nodes += othello::Perft(pos, (int)state.range(0));
+    state.counters["nodes/s"] = benchmark::Counter((double)nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_OthelloPerft)->Arg(7)->Unit(benchmark::kMillisecond);
+
+// Batched kernels: range(1) picks the kernel, 0 = scalar, 1 = AVX2
+static bool UseKernel(benchmark::State& state) {
+    othello::BatchKernel kernel = state.range(1) ? othello::BATCH_AVX2 : othello::BATCH_SCALAR;
+    if (othello::SetBatchKernel(kernel)) return true;
+    state.SkipWithError("kernel not supported on this CPU");
+    return false;
+}
+
+static void BM_OthelloGenerateChildren(benchmark::State& state) {
+    if (!UseKernel(state)) return;
+    othello::Position pos = OthelloPosition((int)state.range(0));
+    othello::MoveList list;
+    othello::GenerateMoves(pos, list);
+    othello::Position children[othello::MAX_MOVES];
+    for (auto _ : state) {
+        othello::GenerateChildren(pos, list, children);
+        benchmark::DoNotOptimize(children[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * list.count);
+}
+BENCHMARK(BM_OthelloGenerateChildren)->ArgsProduct({{0, 1, 2}, {0, 1}});
+
+static void BM_OthelloScoreLeaves(benchmark::State& state) {
+    if (!UseKernel(state)) return;
+    othello::Position pos = OthelloPosition((int)state.range(0));
+    othello::MoveList list;
+    othello::GenerateMoves(pos, list);
+    othello::Position children[othello::MAX_MOVES];
+    int scores[othello::MAX_MOVES];
+    othello::GenerateChildren(pos, list, children);
+    for (auto _ : state) {
+        othello::ScoreLeaves(children, list.count, scores);
+        benchmark::DoNotOptimize(scores[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * list.count);
+}
+BENCHMARK(BM_OthelloScoreLeaves)->ArgsProduct({{0, 1, 2}, {0, 1}});
+
+// range(0) is the depth; nodes/s is the per-node speed of each kernel
+static void BM_OthelloSearch(benchmark::State& state) {
+    if (!UseKernel(state)) return;
+    othello::Position pos = OthelloPosition(1);
+    othello::Searcher searcher;
+    othello::SearchLimits limits;
+    limits.maxDepth = (int)state.range(0);
+    uint64_t nodes = 0;
+    for (auto _ : state) {
+        searcher.ClearTable();
+        nodes += searcher.Search(pos, limits).nodes;
+    }
+    state.counters["nodes/s"] = benchmark::Counter((double)nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_OthelloSearch)->ArgsProduct({{6, 8}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Other board sizes: the generic kernel per size, with the 8x8 instance for comparison
+// against BM_OthelloPerft
+template <int N>
+static void BM_OthelloVariantPerft(benchmark::State& state) {
+    typedef othello::VariantRules<N> Rules;
+    typename Rules::Position pos = Rules::StartPosition();
+    uint64_t nodes = 0;
+    for (auto _ : state) nodes += Rules::Perft(pos, (int)state.range(0));
+    state.counters["nodes/s"] = benchmark::Counter((double)nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_OthelloVariantPerft, 6)->Arg(7)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OthelloVariantPerft, 8)->Arg(7)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OthelloVariantPerft, 10)->Arg(7)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OthelloVariantPerft, 16)->Arg(7)->Unit(benchmark::kMillisecond);
+
+// --- Battleship ---
+
+// A game part-way through: the given number of random shots at a seeded fleet,
+// with sunk ships reported the way the AI learns them
+static ShotKnowledge BattleshipKnowledge(const FleetConfig& config, int shots, uint64_t seed) {
+    Rng rng(seed);
+    Grid grid(config);
+    grid.PlaceAllShips(rng);
+    ShotKnowledge knowledge(config);
+    for (int i = 0; i < shots; ++i) {
+        WideMask unshot = ~knowledge.Shot();
+        unshot.Trim(knowledge.Cells());
+        int cell = MaskSelect(unshot, rng.Below(unshot.Count()));
+        bool hit;
+        int sunkShip;
+        grid.Attack({ cell % config.gridSize, cell / config.gridSize }, hit, &sunkShip);
+        if (!hit) {
+            knowledge.misses.Set(cell);
+            continue;
+        }
+        knowledge.hits.Set(cell);
+        if (sunkShip == Grid::NO_SHIP) continue;
+        const Ship& ship = grid.ships[sunkShip];
+        for (int j = 0; j < ship.size; ++j) knowledge.sunk.Set(ship.Cell(j).y * config.gridSize + ship.Cell(j).x);
+        knowledge.remaining[ship.size]--;
+    }
+    return knowledge;
+}
+
+static FleetConfig LargeFleet() {
+    FleetConfig config;
+    config.gridSize = 100;
+    config.shipSizes.clear();
+    for (int size = 2; size <= MAX_SHIP_LENGTH; ++size)
+        for (int i = 0; i < 4; ++i) config.shipSizes.push_back(size);
+    return config;
+}
+
+// range(0): 10 for the standard grid, 100 for a 100x100 grid with a 36-ship fleet
+static FleetConfig BattleshipConfig(int gridSize) {
+    return gridSize == STANDARD_GRID_SIZE ? FleetConfig() : LargeFleet();
+}
+
+// A quarter of the standard grid shot, but only a twentieth of the large one: random
+// fire leaves far more open hits than a real AI would, and they make sampling stall
+static ShotKnowledge BattleshipMidgame(const FleetConfig& config) {
+    int shots = config.IsStandardGrid() ? config.Cells() / 4 : config.Cells() / 20;
+    return BattleshipKnowledge(config, shots, 7);
+}
+
+static void BM_BattleshipPlaceFleet(benchmark::State& state) {
+    FleetConfig config = BattleshipConfig((int)state.range(0));
+    Grid grid(config);
+    Rng rng(1);
+    for (auto _ : state) benchmark::DoNotOptimize(grid.PlaceAllShips(rng));
+}
+BENCHMARK(BM_BattleshipPlaceFleet)->Arg(10)->Arg(100);
+
+static void BM_BattleshipDensity(benchmark::State& state) {
+    FleetConfig config = BattleshipConfig((int)state.range(0));
+    ShotKnowledge knowledge = BattleshipMidgame(config);
+    DensityTargeting targeting;
+    std::vector<int> density;
+    for (auto _ : state) {
+        targeting.ComputeDensity(knowledge, density);
+        benchmark::DoNotOptimize(density.data());
+    }
+}
+BENCHMARK(BM_BattleshipDensity)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+static void BM_BattleshipMonteCarlo(benchmark::State& state) {
+    FleetConfig config = BattleshipConfig((int)state.range(0));
+    ShotKnowledge knowledge = BattleshipMidgame(config);
+    MonteCarloTargeting sampler;
+    sampler.threads = 1;                // Single-thread throughput, independent of the machine
+    sampler.sampleBudget = 1000;
+    sampler.maxLatencyMs = 1e9;
+    std::vector<double> likelihood;
+    int64_t samples = 0;
+    for (auto _ : state) samples += sampler.SampleOccupancy(knowledge, likelihood);
+    state.counters["samples/s"] = benchmark::Counter((double)samples, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_BattleshipMonteCarlo)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+#include "CheckersAI.h"
+#include <chrono>
+
+namespace checkers {
+
+const int PONDER_MAX_DEPTH = 24;    // Pondering stops by itself once this deep
+
+static double NowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// --- PonderingAI ---
+
+PonderingAI::PonderingAI(double thinkTimeMs, int instantDepth)
+    : search(searcher), thinkTimeMs(thinkTimeMs), instantDepth(instantDepth) {}
+
+void PonderingAI::StartTurn(const Position& pos) {
+    if (pondering && searchRoot == pos) {
+        // Ponder hit: the running search is already on this position
+        ponderHits++;
+        pondering = false;
+        thinking = true;
+        deadlineMs = NowMs() + thinkTimeMs;
+        return;
+    }
+    if (pondering) ponderMisses++;
+
+    search.Stop();
+    pondering = false;
+    searchRoot = pos;
+    SearchLimits limits;
+    limits.maxTimeMs = thinkTimeMs;
+    limits.cacheDepth = instantDepth;   // Deep enough to play at once, so deep enough to reuse
+    search.Start(pos, limits);
+    thinking = true;
+    deadlineMs = NowMs() + thinkTimeMs;
+}
+
+bool PonderingAI::PollMove(SearchResult& result) {
+    if (!thinking) return false;
+
+    // Deep enough is good enough; after a ponder hit this is often true immediately
+    bool done = search.Finished() || NowMs() >= deadlineMs || search.Latest().depth >= instantDepth;
+    if (!done) return false;
+
+    search.Stop();
+    result = search.Latest();
+    thinking = false;
+    if (result.hasMove) StartPondering(MakeMove(searchRoot, result.bestMove), result);
+    return true;
+}
+
+void PonderingAI::StartPondering(const Position& afterMove, const SearchResult& result) {
+    MoveList replies;
+    GenerateMoves(afterMove, replies);
+    if (replies.count == 0) return;     // The human has lost; nothing to think about
+
+    // Without a predicted reply, searching the human's position still warms the table
+    searchRoot = afterMove;
+    if (result.pv.size() >= 2) searchRoot = MakeMove(afterMove, result.pv[1]);
+
+    SearchLimits limits;
+    limits.maxDepth = PONDER_MAX_DEPTH;
+    search.Start(searchRoot, limits);
+    pondering = true;
+}
+
+void PonderingAI::Stop() {
+    search.Stop();
+    thinking = false;
+    pondering = false;
+}
+
+} // namespace checkers
@@ -0,0 +1,42 @@
+#pragma once
+
+// Background searching for the Checkers AI - no raylib dependency
+#include "CheckersEngine.h"
+#include "AsyncSearch.h"
+
+namespace checkers {
+
+// The shared worker-thread search from Common, over this engine's types
+using AsyncSearch = ::AsyncSearch<Searcher, Position, SearchLimits, SearchResult>;
+
+// AI opponent that keeps searching while the human thinks.
+// After each AI move it searches the position after the predicted human reply (the
+// second move of its principal variation). If the human plays that reply the search
+// simply carries on and usually finishes at once; otherwise it is restarted on the
+// real position with the transposition table still warm.
+class PonderingAI {
+    private:
+        Searcher searcher;
+        AsyncSearch search;
+        Position searchRoot;            // Position the running search belongs to
+        bool thinking = false;          // Searching for a move to play now (not pondering)
+        bool pondering = false;
+        double deadlineMs = 0;
+        double thinkTimeMs;
+        int instantDepth;
+
+        void StartPondering(const Position& afterMove, const SearchResult& result);
+
+    public:
+        int ponderHits = 0;
+        int ponderMisses = 0;
+
+        // thinkTimeMs: budget per move; instantDepth: a result this deep is played at once
+        explicit PonderingAI(double thinkTimeMs = 1000, int instantDepth = 10);
+
+        void StartTurn(const Position& pos);    // The AI is to move in pos
+        bool PollMove(SearchResult& result);    // Non-blocking; true once the move is decided
+        void Stop();                            // Stop thinking or pondering (game over, reset)
+};
+
+} // namespace checkers
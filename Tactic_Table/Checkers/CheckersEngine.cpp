@@ -0,0 +1,545 @@
+#include "CheckersEngine.h"
+#include "PositionCache.h"
+#include <algorithm>
+#include <chrono>
+
+namespace checkers {
+
+// Directions match the game's dr/dc tables: 0,1 move down the board (AI), 2,3 move up (human)
+static const int DIR_ROW[4] = {1, 1, -1, -1};
+static const int DIR_COL[4] = {-1, 1, -1, 1};
+
+// Precomputed neighbour tables so move generation never touches row/column arithmetic
+struct Tables {
+    int8_t step[NUM_SQUARES][4];    // Adjacent square in each direction, or -1
+    int8_t jump[NUM_SQUARES][4];    // Landing square two steps away, or -1
+    int advance[2][NUM_SQUARES];    // Evaluation bonus for men by how far they have advanced
+    uint64_t zobrist[2][2][NUM_SQUARES];    // [side][isKing][square]
+    uint64_t zobristSide;
+
+    Tables() {
+        for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+            int r = RowOf(sq), c = ColOf(sq);
+            for (int d = 0; d < 4; ++d) {
+                step[sq][d] = (int8_t)SquareOf(r + DIR_ROW[d], c + DIR_COL[d]);
+                jump[sq][d] = (int8_t)SquareOf(r + 2 * DIR_ROW[d], c + 2 * DIR_COL[d]);
+            }
+            advance[HUMAN_SIDE][sq] = (7 - r) * 3;
+            advance[AI_SIDE][sq] = r * 3;
+        }
+        // Back-row men guard against enemy promotion
+        for (int sq = 0; sq < 4; ++sq) advance[AI_SIDE][sq] = 8;
+        for (int sq = 28; sq < 32; ++sq) advance[HUMAN_SIDE][sq] = 8;
+
+        uint64_t seed = 0x9E3779B97F4A7C15ULL;
+        auto next = [&seed]() {
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        };
+        for (int s = 0; s < 2; ++s)
+            for (int k = 0; k < 2; ++k)
+                for (int sq = 0; sq < NUM_SQUARES; ++sq)
+                    zobrist[s][k][sq] = next();
+        zobristSide = next();
+    }
+};
+
+static const Tables tables;
+
+static const uint32_t PROMOTION_ROW[2] = {0x0000000Fu, 0xF0000000u};   // Row 0 for human, row 7 for AI
+
+static inline int PopCount(uint32_t bits) { return __builtin_popcount(bits); }
+static inline int LowestBit(uint32_t bits) { return __builtin_ctz(bits); }
+
+static inline double NowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+Position StartPosition() {
+    Position pos;
+    pos.pieces[AI_SIDE] = 0x00000FFFu;      // Rows 0-2
+    pos.pieces[HUMAN_SIDE] = 0xFFF00000u;   // Rows 5-7
+    pos.kings = 0;
+    pos.sideToMove = HUMAN_SIDE;
+    pos.hash = ComputeHash(pos);
+    return pos;
+}
+
+uint64_t ComputeHash(const Position& pos) {
+    uint64_t hash = 0;
+    for (int s = 0; s < 2; ++s) {
+        for (uint32_t bits = pos.pieces[s]; bits; bits &= bits - 1) {
+            int sq = LowestBit(bits);
+            hash ^= tables.zobrist[s][(pos.kings >> sq) & 1][sq];
+        }
+    }
+    if (pos.sideToMove == AI_SIDE) hash ^= tables.zobristSide;
+    return hash;
+}
+
+bool FromString(const std::string& text, Position& pos) {
+    if (text.size() != 34 || text[1] != ':') return false;
+    Position result;
+    if (text[0] == 'h') result.sideToMove = HUMAN_SIDE;
+    else if (text[0] == 'a') result.sideToMove = AI_SIDE;
+    else return false;
+
+    for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+        uint32_t bit = 1u << sq;
+        switch (text[2 + sq]) {
+            case 'h': result.pieces[HUMAN_SIDE] |= bit; break;
+            case 'H': result.pieces[HUMAN_SIDE] |= bit; result.kings |= bit; break;
+            case 'a': result.pieces[AI_SIDE] |= bit; break;
+            case 'A': result.pieces[AI_SIDE] |= bit; result.kings |= bit; break;
+            case '.': break;
+            default: return false;
+        }
+    }
+    result.hash = ComputeHash(result);
+    pos = result;
+    return true;
+}
+
+std::string ToString(const Position& pos) {
+    std::string text = pos.sideToMove == HUMAN_SIDE ? "h:" : "a:";
+    for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+        uint32_t bit = 1u << sq;
+        char c = '.';
+        if (pos.pieces[HUMAN_SIDE] & bit) c = 'h';
+        else if (pos.pieces[AI_SIDE] & bit) c = 'a';
+        if ((pos.kings & bit) && c != '.') c = (char)(c - 'a' + 'A');
+        text += c;
+    }
+    return text;
+}
+
+std::string MoveToString(const Move& move) {
+    std::string text = std::to_string(move.from + 1);
+    for (int i = 0; i < move.pathLen; ++i) {
+        text += move.IsCapture() ? 'x' : '-';
+        text += std::to_string(move.path[i] + 1);
+    }
+    return text;
+}
+
+bool ParseMove(const Position& pos, const std::string& text, Move& move) {
+    MoveList list;
+    GenerateMoves(pos, list);
+    for (int i = 0; i < list.count; ++i) {
+        if (MoveToString(list.moves[i]) == text) {
+            move = list.moves[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Depth-first walk of a capture chain; a man that reaches the last row stops there
+static void ExtendCapture(const Position& pos, int side, bool king, int cur, uint32_t captured,
+                          uint32_t empty, Move& partial, MoveList& list) {
+    bool extended = false;
+    int dFirst = king ? 0 : (side == AI_SIDE ? 0 : 2);
+    int dLast = king ? 4 : dFirst + 2;
+
+    for (int d = dFirst; d < dLast; ++d) {
+        int to = tables.jump[cur][d];
+        if (to < 0) continue;
+        int over = tables.step[cur][d];
+        uint32_t overBit = 1u << over;
+        if (!(pos.pieces[side ^ 1] & overBit) || (captured & overBit)) continue;
+        if (!(empty & (1u << to))) continue;
+
+        extended = true;
+        partial.path[partial.pathLen++] = (uint8_t)to;
+        if (!king && (PROMOTION_ROW[side] & (1u << to))) {
+            Move& move = list.moves[list.count++];
+            move = partial;
+            move.to = (uint8_t)to;
+            move.captured = captured | overBit;
+        } else {
+            ExtendCapture(pos, side, king, to, captured | overBit, empty, partial, list);
+        }
+        partial.pathLen--;
+    }
+
+    if (!extended && partial.pathLen > 0) {
+        Move& move = list.moves[list.count++];
+        move = partial;
+        move.to = (uint8_t)cur;
+        move.captured = captured;
+    }
+}
+
+static void GenerateCaptures(const Position& pos, MoveList& list) {
+    int side = pos.sideToMove;
+    uint32_t occupied = pos.Occupied();
+    for (uint32_t bits = pos.pieces[side]; bits; bits &= bits - 1) {
+        int sq = LowestBit(bits);
+        Move partial;
+        partial.from = (uint8_t)sq;
+        // The moving piece's own square is free to land on again during the chain
+        uint32_t empty = ~occupied | (1u << sq);
+        ExtendCapture(pos, side, (pos.kings >> sq) & 1, sq, 0, empty, partial, list);
+    }
+}
+
+void GenerateMoves(const Position& pos, MoveList& list) {
+    list.count = 0;
+    GenerateCaptures(pos, list);
+    if (list.count > 0) return;
+
+    int side = pos.sideToMove;
+    uint32_t empty = ~pos.Occupied();
+    for (uint32_t bits = pos.pieces[side]; bits; bits &= bits - 1) {
+        int sq = LowestBit(bits);
+        bool king = (pos.kings >> sq) & 1;
+        int dFirst = king ? 0 : (side == AI_SIDE ? 0 : 2);
+        int dLast = king ? 4 : dFirst + 2;
+        for (int d = dFirst; d < dLast; ++d) {
+            int to = tables.step[sq][d];
+            if (to < 0 || !(empty & (1u << to))) continue;
+            Move& move = list.moves[list.count++];
+            move.from = (uint8_t)sq;
+            move.to = (uint8_t)to;
+            move.pathLen = 1;
+            move.path[0] = (uint8_t)to;
+            move.captured = 0;
+        }
+    }
+}
+
+bool HasCapture(const Position& pos) {
+    int side = pos.sideToMove;
+    uint32_t empty = ~pos.Occupied();
+    uint32_t enemy = pos.pieces[side ^ 1];
+    for (uint32_t bits = pos.pieces[side]; bits; bits &= bits - 1) {
+        int sq = LowestBit(bits);
+        bool king = (pos.kings >> sq) & 1;
+        int dFirst = king ? 0 : (side == AI_SIDE ? 0 : 2);
+        int dLast = king ? 4 : dFirst + 2;
+        for (int d = dFirst; d < dLast; ++d) {
+            int to = tables.jump[sq][d];
+            if (to >= 0 && (enemy & (1u << tables.step[sq][d])) && (empty & (1u << to)))
+                return true;
+        }
+    }
+    return false;
+}
+
+Position MakeMove(const Position& pos, const Move& move) {
+    Position next = pos;
+    int side = pos.sideToMove;
+    uint32_t fromBit = 1u << move.from;
+    uint32_t toBit = 1u << move.to;
+    bool king = pos.kings & fromBit;
+
+    next.pieces[side] = (next.pieces[side] & ~fromBit) | toBit;
+    next.hash ^= tables.zobrist[side][king][move.from];
+    next.kings &= ~fromBit;
+
+    if (!king && (PROMOTION_ROW[side] & toBit)) king = true;
+    if (king) next.kings |= toBit;
+    next.hash ^= tables.zobrist[side][king][move.to];
+
+    for (uint32_t bits = move.captured; bits; bits &= bits - 1) {
+        int sq = LowestBit(bits);
+        next.hash ^= tables.zobrist[side ^ 1][(pos.kings >> sq) & 1][sq];
+    }
+    next.pieces[side ^ 1] &= ~move.captured;
+    next.kings &= ~move.captured;
+
+    next.sideToMove = side ^ 1;
+    next.hash ^= tables.zobristSide;
+    return next;
+}
+
+uint64_t Perft(const Position& pos, int depth) {
+    if (depth == 0) return 1;
+    MoveList list;
+    GenerateMoves(pos, list);
+    if (depth == 1) return (uint64_t)list.count;
+
+    uint64_t total = 0;
+    for (int i = 0; i < list.count; ++i)
+        total += Perft(MakeMove(pos, list.moves[i]), depth - 1);
+    return total;
+}
+
+int Evaluate(const Position& pos) {
+    int score[2] = {0, 0};
+    for (int s = 0; s < 2; ++s) {
+        uint32_t men = pos.pieces[s] & ~pos.kings;
+        score[s] += PopCount(men) * 100 + PopCount(pos.pieces[s] & pos.kings) * 160;
+        for (; men; men &= men - 1)
+            score[s] += tables.advance[s][LowestBit(men)];
+    }
+    int side = pos.sideToMove;
+    return score[side] - score[side ^ 1];
+}
+
+// --- Search ---
+
+enum TTFlag : uint8_t { TT_EXACT, TT_LOWER, TT_UPPER };
+
+Searcher::Searcher(int tableSizeMB) {
+    size_t entries = 1;
+    while (entries * 2 * sizeof(TTEntry) <= (size_t)tableSizeMB * 1024 * 1024) entries *= 2;
+    table.resize(entries);
+    tableMask = entries - 1;
+}
+
+void Searcher::ClearTable() {
+    std::fill(table.begin(), table.end(), TTEntry());
+}
+
+// --- Persistent cache ---
+
+// Only nodes this far from the horizon are worth a slot; shallower ones are quicker to
+// search again than the deep ones they would push out
+static const int CACHE_MIN_DEPTH = 6;
+
+static PositionCache* positionCache = nullptr;
+
+void UsePositionCache(PositionCache* cache) { positionCache = cache; }
+
+// Cached moves are indices into GenerateMoves' list, which is the same for a position
+// every time; -1 if the move is not in it
+static int MoveIndex(const Position& pos, const Move& move) {
+    MoveList list;
+    GenerateMoves(pos, list);
+    for (int i = 0; i < list.count; ++i)
+        if (list.moves[i].SameAs(move)) return i;
+    return -1;
+}
+
+bool Searcher::ShouldStop() {
+    if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return true;
+    if (nodeLimit && nodes >= nodeLimit) return true;
+    if (deadlineMs > 0 && NowMs() >= deadlineMs) return true;
+    return false;
+}
+
+// Order moves in place: hash move first, then bigger captures
+static void OrderMoves(MoveList& list, const Move* hashMove) {
+    int first = 0;
+    if (hashMove) {
+        for (int i = 0; i < list.count; ++i) {
+            if (list.moves[i].SameAs(*hashMove)) {
+                std::swap(list.moves[0], list.moves[i]);
+                first = 1;
+                break;
+            }
+        }
+    }
+    if (list.count - first > 1 && list.moves[first].IsCapture()) {
+        std::stable_sort(list.moves + first, list.moves + list.count, [](const Move& a, const Move& b) {
+            return PopCount(a.captured) > PopCount(b.captured);
+        });
+    }
+}
+
+int Searcher::AlphaBeta(const Position& pos, int depth, int ply, int alpha, int beta) {
+    if ((++nodes & 1023) == 0 && ShouldStop()) aborted = true;
+    if (aborted) return 0;
+
+    MoveList list;
+    GenerateMoves(pos, list);
+    if (list.count == 0) return -SCORE_WIN + ply;
+    // Forced captures are searched past the horizon so the evaluation is never mid-exchange
+    if (depth <= 0 && !list.moves[0].IsCapture()) return Evaluate(pos);
+
+    TTEntry& entry = table[pos.hash & tableMask];
+    Move hashMove;
+    bool haveHashMove = false;
+    if (entry.key == pos.hash) {
+        hashMove.from = entry.moveFrom;
+        hashMove.to = entry.moveTo;
+        hashMove.captured = entry.moveCaptured;
+        haveHashMove = true;
+        if (entry.depth >= depth) {
+            int ttScore = entry.score;
+            if (ttScore > SCORE_WIN - 1000) ttScore -= ply;
+            else if (ttScore < -SCORE_WIN + 1000) ttScore += ply;
+            if (entry.flag == TT_EXACT) return ttScore;
+            if (entry.flag == TT_LOWER && ttScore >= beta) return ttScore;
+            if (entry.flag == TT_UPPER && ttScore <= alpha) return ttScore;
+        }
+    }
+
+    // A deep node may have been searched in an earlier game or session. Its score is only
+    // used once the iteration has reached the trusted depth: cutting off an earlier one
+    // would leave the table without the move ordering the later ones rely on.
+    CachedPosition cached;
+    if (cache && depth >= CACHE_MIN_DEPTH && cache->Probe(pos.hash, cached) && cached.move < list.count) {
+        if (!haveHashMove) {
+            hashMove = list.moves[cached.move];
+            haveHashMove = true;
+        }
+        if (cached.depth >= depth + cacheSlack) {
+            int cachedScore = cached.score;
+            if (cachedScore > SCORE_WIN - 1000) cachedScore -= ply;
+            else if (cachedScore < -SCORE_WIN + 1000) cachedScore += ply;
+            if (cached.flag == TT_EXACT) return cachedScore;
+            if (cached.flag == TT_LOWER && cachedScore >= beta) return cachedScore;
+            if (cached.flag == TT_UPPER && cachedScore <= alpha) return cachedScore;
+        }
+    }
+
+    OrderMoves(list, haveHashMove ? &hashMove : nullptr);
+
+    int originalAlpha = alpha;
+    int bestScore = -SCORE_WIN - 1;
+    int bestIndex = 0;
+    for (int i = 0; i < list.count; ++i) {
+        int score = -AlphaBeta(MakeMove(pos, list.moves[i]), depth - 1, ply + 1, -beta, -alpha);
+        if (aborted) return 0;
+        if (score > bestScore) {
+            bestScore = score;
+            bestIndex = i;
+        }
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) break;
+    }
+
+    if (depth > 0) {
+        int stored = bestScore;
+        if (stored > SCORE_WIN - 1000) stored += ply;
+        else if (stored < -SCORE_WIN + 1000) stored -= ply;
+        entry.key = pos.hash;
+        entry.score = (int16_t)stored;
+        entry.depth = (int8_t)std::min(depth, 127);
+        entry.flag = bestScore <= originalAlpha ? TT_UPPER : (bestScore >= beta ? TT_LOWER : TT_EXACT);
+        entry.moveFrom = list.moves[bestIndex].from;
+        entry.moveTo = list.moves[bestIndex].to;
+        entry.moveCaptured = list.moves[bestIndex].captured;
+        if (cache && depth >= CACHE_MIN_DEPTH) {
+            cached.score = stored;
+            cached.depth = depth;
+            cached.flag = entry.flag;
+            cached.move = MoveIndex(pos, list.moves[bestIndex]);
+            cache->Store(pos.hash, cached);
+        }
+    }
+    return bestScore;
+}
+
+void Searcher::ExtractPV(Position pos, int depth, std::vector<Move>& pv) {
+    pv.clear();
+    for (int i = 0; i < depth; ++i) {
+        const TTEntry& entry = table[pos.hash & tableMask];
+        if (entry.key != pos.hash) break;
+        MoveList list;
+        GenerateMoves(pos, list);
+        int found = -1;
+        for (int m = 0; m < list.count; ++m) {
+            const Move& move = list.moves[m];
+            if (move.from == entry.moveFrom && move.to == entry.moveTo && move.captured == entry.moveCaptured) {
+                found = m;
+                break;
+            }
+        }
+        if (found < 0) break;
+        pv.push_back(list.moves[found]);
+        pos = MakeMove(pos, list.moves[found]);
+    }
+}
+
+SearchResult Searcher::Search(const Position& pos, const SearchLimits& limits) {
+    SearchResult result;
+    startMs = NowMs();
+    deadlineMs = limits.maxTimeMs > 0 ? startMs + limits.maxTimeMs : 0;
+    nodeLimit = limits.maxNodes;
+    stopFlag = limits.stop;
+    nodes = 0;
+    aborted = false;
+    cache = positionCache;
+
+    MoveList rootMoves;
+    GenerateMoves(pos, rootMoves);
+    if (rootMoves.count == 0) {
+        result.score = -SCORE_WIN;
+        return result;
+    }
+    result.hasMove = true;
+    result.bestMove = rootMoves.moves[0];
+
+    // Searched this deep before: play that move without searching again. A time limit
+    // leaves maxDepth out of reach, so the cache is trusted from cacheDepth on.
+    int trustedDepth = std::min(limits.maxDepth, limits.cacheDepth);
+    CachedPosition cached;
+    if (cache && cache->Probe(pos.hash, cached) && cached.flag == TT_EXACT && cached.depth >= trustedDepth
+        && cached.move < rootMoves.count) {
+        result.bestMove = rootMoves.moves[cached.move];
+        result.score = cached.score;
+        result.depth = cached.depth;
+        result.pv.push_back(result.bestMove);
+        result.elapsedMs = NowMs() - startMs;
+        if (limits.onIteration) limits.onIteration(result);
+        return result;
+    }
+
+    for (int depth = 1; depth <= limits.maxDepth; ++depth) {
+        cacheSlack = std::max(trustedDepth - depth, 0);
+        // Previous iteration's best move goes first
+        OrderMoves(rootMoves, &result.bestMove);
+
+        int alpha = -SCORE_WIN - 1, beta = SCORE_WIN + 1;
+        int bestScore = -SCORE_WIN - 1;
+        int bestIndex = 0;
+        for (int i = 0; i < rootMoves.count; ++i) {
+            int score = -AlphaBeta(MakeMove(pos, rootMoves.moves[i]), depth - 1, 1, -beta, -alpha);
+            if (aborted) break;
+            if (score > bestScore) {
+                bestScore = score;
+                bestIndex = i;
+            }
+            if (score > alpha) alpha = score;
+        }
+        if (aborted) break;
+
+        result.bestMove = rootMoves.moves[bestIndex];
+        result.score = bestScore;
+        result.depth = depth;
+
+        TTEntry& entry = table[pos.hash & tableMask];
+        entry.key = pos.hash;
+        entry.score = (int16_t)bestScore;
+        entry.depth = (int8_t)std::min(depth, 127);
+        entry.flag = TT_EXACT;
+        entry.moveFrom = result.bestMove.from;
+        entry.moveTo = result.bestMove.to;
+        entry.moveCaptured = result.bestMove.captured;
+        if (cache && depth >= CACHE_MIN_DEPTH) {
+            cached.score = bestScore;
+            cached.depth = depth;
+            cached.flag = TT_EXACT;
+            cached.move = MoveIndex(pos, result.bestMove);
+            cache->Store(pos.hash, cached);
+        }
+
+        if (limits.onIteration) {
+            ExtractPV(pos, depth, result.pv);
+            result.nodes = nodes;
+            result.elapsedMs = NowMs() - startMs;
+            limits.onIteration(result);
+        }
+
+        // A decided game needs no deeper search
+        if (bestScore > SCORE_WIN - 1000 || bestScore < -SCORE_WIN + 1000) break;
+        if (ShouldStop()) break;
+    }
+
+    ExtractPV(pos, std::max(result.depth, 1), result.pv);
+    if (result.pv.empty() || !result.pv[0].SameAs(result.bestMove)) {
+        result.pv.clear();
+        result.pv.push_back(result.bestMove);
+    }
+    result.nodes = nodes;
+    result.elapsedMs = NowMs() - startMs;
+    return result;
+}
+
+} // namespace checkers
@@ -0,0 +1,140 @@
+#pragma once
+
+// Checkers rules engine - no raylib dependency, shared by the game and the benchmark
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class PositionCache;
+
+namespace checkers {
+
+const int NUM_SQUARES = 32;     // Playable (dark) squares on the 8x8 board
+const int MAX_MOVES = 128;      // Upper bound on legal moves in one position
+const int MAX_PATH = 12;        // Upper bound on landing squares in one capture chain
+const int SCORE_WIN = 30000;    // Score for a won position (minus distance to the win)
+
+// Sides match the game's Player enum: HUMAN moves up the board, AI moves down
+enum Side { HUMAN_SIDE = 0, AI_SIDE = 1 };
+
+// Square numbering: 0..31 row by row from the top (AI) edge, left to right
+inline int SquareOf(int row, int col) {
+    if (row < 0 || row >= 8 || col < 0 || col >= 8 || (row + col) % 2 == 0) return -1;
+    return row * 4 + col / 2;
+}
+inline int RowOf(int sq) { return sq / 4; }
+inline int ColOf(int sq) { return 2 * (sq % 4) + ((sq / 4) % 2 == 0 ? 1 : 0); }
+
+// Compact board: one 32-bit mask per side plus a king mask
+struct Position {
+    uint32_t pieces[2] = {0, 0};    // Indexed by Side
+    uint32_t kings = 0;             // Kings of either side
+    int sideToMove = HUMAN_SIDE;
+    uint64_t hash = 0;              // Zobrist key, kept in sync by MakeMove
+
+    uint32_t Occupied() const { return pieces[0] | pieces[1]; }
+    bool operator==(const Position& other) const {
+        return pieces[0] == other.pieces[0] && pieces[1] == other.pieces[1] &&
+               kings == other.kings && sideToMove == other.sideToMove;
+    }
+};
+
+// A full move: a single step or a complete capture chain
+struct Move {
+    uint8_t from = 0;
+    uint8_t to = 0;
+    uint8_t pathLen = 0;            // Number of landing squares
+    uint8_t path[MAX_PATH] = {};    // Landing squares in order; path[pathLen - 1] == to
+    uint32_t captured = 0;          // Squares of the captured pieces
+
+    bool IsCapture() const { return captured != 0; }
+    bool SameAs(const Move& other) const {
+        return from == other.from && to == other.to && captured == other.captured;
+    }
+};
+
+struct MoveList {
+    Move moves[MAX_MOVES];
+    int count = 0;
+};
+
+// Board setup and conversion
+Position StartPosition();
+uint64_t ComputeHash(const Position& pos);
+bool FromString(const std::string& text, Position& pos);   // "h:aaaa....hhhh" (side, then 32 squares)
+std::string ToString(const Position& pos);
+std::string MoveToString(const Move& move);                // "21-17" or "22x15x8" (1-based squares)
+bool ParseMove(const Position& pos, const std::string& text, Move& move);
+
+// Rules
+void GenerateMoves(const Position& pos, MoveList& list);   // Captures are mandatory
+bool HasCapture(const Position& pos);
+Position MakeMove(const Position& pos, const Move& move);
+uint64_t Perft(const Position& pos, int depth);
+
+// Deep search results shared by every Searcher and kept between sessions (Common/PositionCache.h).
+// Set it before any search starts; null, the default, searches without one.
+void UsePositionCache(PositionCache* cache);
+
+// Static evaluation from the side to move's point of view
+int Evaluate(const Position& pos);
+
+struct SearchResult;
+
+struct SearchLimits {
+    int maxDepth = 64;
+    uint64_t maxNodes = 0;                      // 0 = unlimited
+    double maxTimeMs = 0;                       // 0 = unlimited
+    int cacheDepth = 10;                        // Cached results this deep are reused without searching
+    const std::atomic<bool>* stop = nullptr;    // Checked between nodes
+    std::function<void(const SearchResult&)> onIteration;  // Called after each completed depth
+};
+
+struct SearchResult {
+    bool hasMove = false;
+    Move bestMove;
+    int score = 0;
+    int depth = 0;                  // Last fully completed iteration
+    uint64_t nodes = 0;
+    double elapsedMs = 0;
+    std::vector<Move> pv;
+};
+
+// Iterative-deepening alpha-beta search with a transposition table
+class Searcher {
+    private:
+        struct TTEntry {
+            uint64_t key = 0;
+            int16_t score = 0;
+            int8_t depth = -1;
+            uint8_t flag = 0;
+            uint8_t moveFrom = 0;
+            uint8_t moveTo = 0;
+            uint32_t moveCaptured = 0;
+        };
+
+        std::vector<TTEntry> table;
+        uint64_t tableMask = 0;
+        uint64_t nodes = 0;
+        uint64_t nodeLimit = 0;
+        double deadlineMs = 0;
+        const std::atomic<bool>* stopFlag = nullptr;
+        bool aborted = false;
+        double startMs = 0;
+        PositionCache* cache = nullptr;     // Picked up from UsePositionCache at each Search
+        int cacheSlack = 0;                 // Plies the current iteration is short of the trusted depth
+
+        int AlphaBeta(const Position& pos, int depth, int ply, int alpha, int beta);
+        bool ShouldStop();
+        void ExtractPV(Position pos, int depth, std::vector<Move>& pv);
+
+    public:
+        explicit Searcher(int tableSizeMB = 16);
+
+        SearchResult Search(const Position& pos, const SearchLimits& limits);
+        void ClearTable();
+};
+
+} // namespace checkers
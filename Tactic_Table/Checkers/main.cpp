@@ -1,9 +1,16 @@
 #include "raylib.h"
+#include "CheckersAI.h"
+#include "CheckersEngine.h"
+#include "ResourceCache.h"
+#include "FramePacer.h"
+#include "PositionCache.h"
 #include <iostream>
 #include <cmath>
 #include <ctime>
+#include <vector>
 
-// FINAL (POLYMORPHISM)
+// Checkers against the computer. The pieces live in one checkers::Position (CheckersEngine);
+// this file draws it and turns clicks into engine moves.
 
 const int SCREEN_WIDTH = 800;
 const int SCREEN_HEIGHT = 800;
@@ -12,226 +19,203 @@ const int BOARD_SIZE = 8;
 
 enum Player { HUMAN, AI, NONE };
 
-class PieceBase {
-    protected:
-        bool isKing;
+// One piece as read from the engine position
+class Piece {
+    private:
         bool isAI;
+        bool isKing;
         int row, col;
-    
+
     public:
-        PieceBase(bool ai = false, int r = 0, int c = 0) : isKing(false), isAI(ai), row(r), col(c) {}
-        virtual ~PieceBase() {}
-    
-        void MakeKing() { isKing = true; }
+        Piece(bool ai = false, int r = 0, int c = 0, bool king = false) : isAI(ai), isKing(king), row(r), col(c) {}
+
         bool IsKing() const { return isKing; }
         bool IsAI() const { return isAI; }
         int GetRow() const { return row; }
         int GetCol() const { return col; }
-        void MoveTo(int r, int c) { row = r; col = c; }
-    
-        virtual void Draw(bool highlight = false) const = 0; // Pure virtual
 };
 
-class HumanPiece : public PieceBase {
-    public:
-        HumanPiece(int r, int c) : PieceBase(false, r, c) {}
-    
-        void Draw(bool highlight = false) const override {
-            if (highlight) DrawCircle(col * TILE_SIZE + TILE_SIZE / 2, row * TILE_SIZE + TILE_SIZE / 2, TILE_SIZE / 2 - 5, YELLOW);
-            DrawCircle(col * TILE_SIZE + TILE_SIZE / 2, row * TILE_SIZE + TILE_SIZE / 2, TILE_SIZE / 3, BLUE);
-            if (isKing) DrawText("K", col * TILE_SIZE + 40, row * TILE_SIZE + 30, 20, YELLOW);
+// Draws the board from the compact engine position. The checkerboard is rendered once
+// into a texture and every piece is a sprite from one atlas, so raylib batches the whole
+// board into a couple of draw calls instead of one or more per tile and piece.
+class BoardRenderer {
+    private:
+        enum Sprite { HUMAN_MAN, HUMAN_KING, AI_MAN, AI_KING, HIGHLIGHT, SPRITE_COUNT };
+
+        RenderTexture2D boardLayer = {};
+        RenderTexture2D pieceAtlas = {};
+        bool loaded = false;
+
+        void DrawSprite(int sprite, int row, int col) const {
+            // Render textures are stored upside down, hence the negative source height
+            Rectangle source = { (float)(sprite * TILE_SIZE), 0, (float)TILE_SIZE, -(float)TILE_SIZE };
+            DrawTextureRec(pieceAtlas.texture, source, { (float)(col * TILE_SIZE), (float)(row * TILE_SIZE) }, WHITE);
         }
-    };
-    
-    class AIPiece : public PieceBase {
+
     public:
-        AIPiece(int r, int c) : PieceBase(true, r, c) {}
-    
-        void Draw(bool highlight = false) const override {
-            if (highlight) DrawCircle(col * TILE_SIZE + TILE_SIZE / 2, row * TILE_SIZE + TILE_SIZE / 2, TILE_SIZE / 2 - 5, YELLOW);
-            DrawCircle(col * TILE_SIZE + TILE_SIZE / 2, row * TILE_SIZE + TILE_SIZE / 2, TILE_SIZE / 3, RED);
-            if (isKing) DrawText("K", col * TILE_SIZE + 40, row * TILE_SIZE + 30, 20, YELLOW);
+        // Needs an open window; call after InitWindow
+        void Load() {
+            boardLayer = LoadRenderTexture(BOARD_SIZE * TILE_SIZE, BOARD_SIZE * TILE_SIZE);
+            BeginTextureMode(boardLayer);
+            for (int r = 0; r < BOARD_SIZE; ++r)
+                for (int c = 0; c < BOARD_SIZE; ++c)
+                    DrawRectangle(c * TILE_SIZE, r * TILE_SIZE, TILE_SIZE, TILE_SIZE, ((r + c) % 2 == 0) ? LIGHTGRAY : DARKGRAY);
+            EndTextureMode();
+
+            pieceAtlas = LoadRenderTexture(SPRITE_COUNT * TILE_SIZE, TILE_SIZE);
+            BeginTextureMode(pieceAtlas);
+            ClearBackground(BLANK);
+            const Color pieceColor[4] = { BLUE, BLUE, RED, RED };
+            for (int sprite = HUMAN_MAN; sprite <= AI_KING; ++sprite) {
+                int x = sprite * TILE_SIZE;
+                DrawCircle(x + TILE_SIZE / 2, TILE_SIZE / 2, TILE_SIZE / 3, pieceColor[sprite]);
+                if (sprite == HUMAN_KING || sprite == AI_KING) DrawText("K", x + 40, 30, 20, YELLOW);
+            }
+            DrawCircle(HIGHLIGHT * TILE_SIZE + TILE_SIZE / 2, TILE_SIZE / 2, TILE_SIZE / 2 - 5, YELLOW);
+            EndTextureMode();
+            loaded = true;
         }
-    };
-    
-    
+
+        // Call before CloseWindow
+        void Unload() {
+            if (!loaded) return;
+            UnloadRenderTexture(boardLayer);
+            UnloadRenderTexture(pieceAtlas);
+            loaded = false;
+        }
+
+        void Draw(const checkers::Position& pos, int highlightRow = -1, int highlightCol = -1) const {
+            Rectangle source = { 0, 0, (float)boardLayer.texture.width, -(float)boardLayer.texture.height };
+            DrawTextureRec(boardLayer.texture, source, { 0, 0 }, WHITE);
+
+            int highlight = checkers::SquareOf(highlightRow, highlightCol);
+            for (uint32_t bits = pos.Occupied(); bits; bits &= bits - 1) {
+                int sq = __builtin_ctz(bits);
+                int row = checkers::RowOf(sq), col = checkers::ColOf(sq);
+                bool ai = (pos.pieces[checkers::AI_SIDE] >> sq) & 1;
+                bool king = (pos.kings >> sq) & 1;
+                if (sq == highlight) DrawSprite(HIGHLIGHT, row, col);
+                DrawSprite(ai ? (king ? AI_KING : AI_MAN) : (king ? HUMAN_KING : HUMAN_MAN), row, col);
+            }
+        }
+};
 
 class Board {
 private:
-    PieceBase* board[BOARD_SIZE][BOARD_SIZE];
+    checkers::Position position;    // The only record of the pieces; the rules engine reads it directly
 
 public:
     Board() { Reset(); }
 
-    ~Board() {
-        for (int r = 0; r < BOARD_SIZE; ++r)
-            for (int c = 0; c < BOARD_SIZE; ++c)
-                delete board[r][c];
-    }
-
-    void Reset() {
-        for (int r = 0; r < BOARD_SIZE; ++r)
-            for (int c = 0; c < BOARD_SIZE; ++c)
-                board[r][c] = nullptr;
-
-        for (int r = 0; r < 3; ++r)
-            for (int c = (r + 1) % 2; c < BOARD_SIZE; c += 2)
-                board[r][c] = new AIPiece(r, c);
+    void Reset() { position = checkers::StartPosition(); }
 
-        for (int r = BOARD_SIZE - 3; r < BOARD_SIZE; ++r)
-            for (int c = (r + 1) % 2; c < BOARD_SIZE; c += 2)
-                board[r][c] = new HumanPiece(r, c);
+    // Engine view of the board with the given side to move
+    checkers::Position GetPosition(Player side) const {
+        checkers::Position pos = position;
+        pos.sideToMove = (side == AI) ? checkers::AI_SIDE : checkers::HUMAN_SIDE;
+        pos.hash = checkers::ComputeHash(pos);
+        return pos;
     }
 
-    PieceBase* GetPiece(int r, int c) const {
-        if (r < 0 || r >= BOARD_SIZE || c < 0 || c >= BOARD_SIZE) return nullptr;
-        return board[r][c];
+    // False if no piece stands on (r, c)
+    bool GetPiece(int r, int c, Piece& piece) const {
+        int sq = checkers::SquareOf(r, c);
+        if (sq < 0 || !((position.Occupied() >> sq) & 1)) return false;
+        piece = Piece((position.pieces[checkers::AI_SIDE] >> sq) & 1, r, c, (position.kings >> sq) & 1);
+        return true;
     }
 
     void MovePiece(int r1, int c1, int r2, int c2) {
-        board[r2][c2] = board[r1][c1];
-        board[r1][c1] = nullptr;
-        if (board[r2][c2]) board[r2][c2]->MoveTo(r2, c2);
-
-        if (board[r2][c2] && !board[r2][c2]->IsKing()) {
-            if ((board[r2][c2]->IsAI() && r2 == BOARD_SIZE - 1) || (!board[r2][c2]->IsAI() && r2 == 0)) {
-                board[r2][c2]->MakeKing();
-            }
+        uint32_t fromBit = 1u << checkers::SquareOf(r1, c1);
+        uint32_t toBit = 1u << checkers::SquareOf(r2, c2);
+        bool isAI = position.pieces[checkers::AI_SIDE] & fromBit;
+        bool isKing = (position.kings & fromBit) || r2 == (isAI ? BOARD_SIZE - 1 : 0);
+        for (int s = 0; s < 2; ++s) {
+            if (position.pieces[s] & fromBit)
+                position.pieces[s] = (position.pieces[s] & ~fromBit) | toBit;
         }
+        position.kings &= ~fromBit;
+        if (isKing) position.kings |= toBit;
     }
 
     void RemovePiece(int r, int c) {
-        delete board[r][c];
-        board[r][c] = nullptr;
+        uint32_t bit = 1u << checkers::SquareOf(r, c);
+        position.pieces[0] &= ~bit;
+        position.pieces[1] &= ~bit;
+        position.kings &= ~bit;
     }
 
-    void Draw(int highlightRow = -1, int highlightCol = -1) const {
-        for (int r = 0; r < BOARD_SIZE; ++r) {
-            for (int c = 0; c < BOARD_SIZE; ++c) {
-                Color tileColor = ((r + c) % 2 == 0) ? LIGHTGRAY : DARKGRAY;
-                DrawRectangle(c * TILE_SIZE, r * TILE_SIZE, TILE_SIZE, TILE_SIZE, tileColor);
-                if (board[r][c]) {
-                    bool highlight = (r == highlightRow && c == highlightCol);
-                    board[r][c]->Draw(highlight);
-                }
-            }
+    // Play a full engine move hop by hop, removing each jumped piece
+    void ApplyMove(const checkers::Move& move) {
+        int sq = move.from;
+        for (int i = 0; i < move.pathLen; ++i) {
+            int r1 = checkers::RowOf(sq), c1 = checkers::ColOf(sq);
+            int r2 = checkers::RowOf(move.path[i]), c2 = checkers::ColOf(move.path[i]);
+            if (move.IsCapture()) RemovePiece((r1 + r2) / 2, (c1 + c2) / 2);
+            MovePiece(r1, c1, r2, c2);
+            sq = move.path[i];
         }
     }
 
     bool HasMoves(bool isAI) const {
-        int dr[4] = {1, 1, -1, -1};
-        int dc[4] = {-1, 1, -1, 1};
-    
-        for (int r = 0; r < BOARD_SIZE; ++r) {
-            for (int c = 0; c < BOARD_SIZE; ++c) {
-                PieceBase* p = board[r][c];
-                if (p && p->IsAI() == isAI) {
-                    for (int d = 0; d < 4; ++d) {
-                        if (!p->IsKing() && ((isAI && dr[d] < 0) || (!isAI && dr[d] > 0))) continue;
-    
-                        // Normal move
-                        int nr = r + dr[d];
-                        int nc = c + dc[d];
-                        if (nr >= 0 && nr < BOARD_SIZE && nc >= 0 && nc < BOARD_SIZE &&
-                            board[nr][nc] == nullptr)
-                            return true;
-    
-                        // Capture move
-                        int mr = r + dr[d];
-                        int mc = c + dc[d];
-                        int tr = r + 2 * dr[d];
-                        int tc = c + 2 * dc[d];
-                        if (tr >= 0 && tr < BOARD_SIZE && tc >= 0 && tc < BOARD_SIZE) {
-                            PieceBase* middle = board[mr][mc];
-                            if (middle && middle->IsAI() != p->IsAI() && board[tr][tc] == nullptr)
-                                return true;
-                        }
-                    }
-                }
-            }
-        }
-    
-        return false;
+        checkers::MoveList list;
+        checkers::GenerateMoves(GetPosition(isAI ? AI : HUMAN), list);
+        return list.count > 0;
     }
-    
 
+    // Reports the first piece that must be captured, for highlighting
     bool HasForcedCaptures(bool isAI, int& highlightRow, int& highlightCol) const {
-        for (int r = 0; r < BOARD_SIZE; ++r) {
-            for (int c = 0; c < BOARD_SIZE; ++c) {
-                PieceBase* p = board[r][c];
-                if (p && p->IsAI() == isAI) {
-                    int dr[4] = {1, 1, -1, -1};
-                    int dc[4] = {-1, 1, -1, 1};
-                    for (int d = 0; d < 4; ++d) {
-                        if (!p->IsKing() && ((isAI && dr[d] < 0) || (!isAI && dr[d] > 0))) continue;
-                        int mr = r + dr[d];
-                        int mc = c + dc[d];
-                        int tr = r + 2 * dr[d];
-                        int tc = c + 2 * dc[d];
-                        if (tr >= 0 && tr < BOARD_SIZE && tc >= 0 && tc < BOARD_SIZE) {
-                            PieceBase* middle = board[mr][mc];
-                            if (board[tr][tc] == nullptr &&
-                                middle && middle->IsAI() != p->IsAI()) {
-                                highlightRow = mr;
-                                highlightCol = mc;
-                                return true;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return false;
-    }
-
-    bool CanCapture(PieceBase* p) const {
-        if (!p) return false;
-        int r = p->GetRow();
-        int c = p->GetCol();
-        int dr[4] = {1, 1, -1, -1};
-        int dc[4] = {-1, 1, -1, 1};
-        for (int d = 0; d < 4; ++d) {
-            if (!p->IsKing() && ((p->IsAI() && dr[d] < 0) || (!p->IsAI() && dr[d] > 0))) continue;
-            int mr = r + dr[d];
-            int mc = c + dc[d];
-            int tr = r + 2 * dr[d];
-            int tc = c + 2 * dc[d];
-            if (tr >= 0 && tr < BOARD_SIZE && tc >= 0 && tc < BOARD_SIZE) {
-                PieceBase* middle = board[mr][mc];
-                if (board[tr][tc] == nullptr && middle && middle->IsAI() != p->IsAI()) {
-                    return true;
-                }
-            }
-        }
-        return false;
+        checkers::MoveList list;
+        checkers::GenerateMoves(GetPosition(isAI ? AI : HUMAN), list);
+        if (list.count == 0 || !list.moves[0].IsCapture()) return false;
+
+        const checkers::Move& move = list.moves[0];
+        highlightRow = (checkers::RowOf(move.from) + checkers::RowOf(move.path[0])) / 2;
+        highlightCol = (checkers::ColOf(move.from) + checkers::ColOf(move.path[0])) / 2;
+        return true;
     }
 };
 
 int main() {
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Checkers Game");
+    InitAudioDevice();
     SetTargetFPS(60);
 
+    ResourceCache resources;
+    SoundHandle moveSound = resources.RequestSound("resources/checkers/move.wav");
+    SoundHandle captureSound = resources.RequestSound("resources/checkers/capture.wav");
+    resources.StartLoading();
+    FramePacer pacer;
+
     Board board;
+    BoardRenderer renderer;
+    renderer.Load();
+    PositionCache positionCache;        // Deep search results from earlier sessions, if the file is free
+    if (positionCache.Open("checkers_cache.bin", "checkers"))
+        checkers::UsePositionCache(&positionCache);
+    checkers::PonderingAI ai;           // Keeps searching on a worker thread during the human's turn
+    bool aiTurnStarted = false;
     Player currentTurn = HUMAN;
-    PieceBase* selectedPiece = nullptr;
+    Piece selectedPiece;
+    bool pieceSelected = false;
     bool gameOver = false;
     Player winner = NONE;
     float endTimer = 0;
-    float aiWaitTimer = 0;
     float invalidMoveTimer = 0;
     bool showInvalidMove = false;
     int highlightRow = -1, highlightCol = -1;
     bool playerMultiCapture = false;
-    int lastCaptureRow = -1, lastCaptureCol = -1;
-    bool aiMultiCapture = false;
-    int aiCaptureRow = -1, aiCaptureCol = -1;
+    checkers::MoveList humanMoves;      // Legal moves at the start of the human's turn
+    std::vector<int> humanPath;         // Squares visited so far this turn (first = start square)
 
     while (!WindowShouldClose()) {
+        resources.Update();
         BeginDrawing();
         ClearBackground(RAYWHITE);
 
+        highlightRow = highlightCol = -1;
         board.HasForcedCaptures(currentTurn == AI, highlightRow, highlightCol);
-        board.Draw(highlightRow, highlightCol);
+        renderer.Draw(board.GetPosition(currentTurn), highlightRow, highlightCol);
 
         if (currentTurn == HUMAN)
             DrawText("Player Turn", 10, 10, 30, BLUE);
@@ -240,7 +224,7 @@ int main() {
 
         if (showInvalidMove) {
             DrawText("Invalid move: Capture is available!", 200, 750, 25, RED);
-            invalidMoveTimer += GetFrameTime();
+            invalidMoveTimer += FramePacer::FrameTime();
             if (invalidMoveTimer > 3.0f) {
                 showInvalidMove = false;
                 invalidMoveTimer = 0;
@@ -252,20 +236,24 @@ int main() {
             Color color = (winner == HUMAN) ? GREEN : RED;
             DrawText(result, 300, 350, 40, color);
 
-            endTimer += GetFrameTime();
+            endTimer += FramePacer::FrameTime();
             if (endTimer > 5) {
                 DrawText("Click to Play Again", 270, 420, 30, BLACK);
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
                     board.Reset();
-                    selectedPiece = nullptr;
+                    pieceSelected = false;
                     currentTurn = HUMAN;
                     winner = NONE;
                     gameOver = false;
                     endTimer = 0;
-                    aiWaitTimer = 0;
+                    aiTurnStarted = false;
+                    playerMultiCapture = false;
+                    humanPath.clear();
                 }
             }
 
+            // Tick until "Click to Play Again" shows, then sleep until the click
+            pacer.Set(endTimer > 5 && resources.IsReady() ? FRAME_IDLE : FRAME_WAITING);
             EndDrawing();
             continue;
         }
@@ -273,123 +261,72 @@ int main() {
         if (currentTurn == HUMAN && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
             int x = GetMouseX() / TILE_SIZE;
             int y = GetMouseY() / TILE_SIZE;
-            PieceBase* clicked = board.GetPiece(y, x);
-
-            if (selectedPiece) {
-                int sr = selectedPiece->GetRow();
-                int sc = selectedPiece->GetCol();
-                int dr = y - sr;
-                int dc = x - sc;
-
-                if ((abs(dr) == 1 && abs(dc) == 1) || (abs(dr) == 2 && abs(dc) == 2)) {
-                    if (!selectedPiece->IsKing()) {
-                        if ((selectedPiece->IsAI() && dr < 0) || (!selectedPiece->IsAI() && dr > 0)) {
-                            selectedPiece = nullptr;
-                            EndDrawing();
-                            continue;
-                        }
-                    }
+            Piece clicked;
+            bool hasClicked = board.GetPiece(y, x, clicked);
 
-                    if (abs(dr) == 2) {
-                        int mr = sr + dr / 2;
-                        int mc = sc + dc / 2;
-                        PieceBase* middle = board.GetPiece(mr, mc);
-                        if (middle && middle->IsAI() != selectedPiece->IsAI()) {
-                            board.RemovePiece(mr, mc);
-                            board.MovePiece(sr, sc, y, x);
-                            selectedPiece = board.GetPiece(y, x);
-                            if (board.CanCapture(selectedPiece)) {
-                                playerMultiCapture = true;
-                            } else {
-                                playerMultiCapture = false;
-                                selectedPiece = nullptr;
-                                currentTurn = AI;
-                            }
-                        }
-                    } else {
-                        int dummy1 = -1, dummy2 = -1;
-                        if (board.HasForcedCaptures(false, dummy1, dummy2)) {
-                            showInvalidMove = true;
-                        } else {
-                            board.MovePiece(sr, sc, y, x);
-                            selectedPiece = nullptr;
-                            currentTurn = AI;
-                        }
-                    }
-                } else {
-                    selectedPiece = nullptr;
+            if (pieceSelected) {
+                int sr = selectedPiece.GetRow();
+                int sc = selectedPiece.GetCol();
+                int target = checkers::SquareOf(y, x);
+
+                if (humanPath.empty()) {
+                    checkers::GenerateMoves(board.GetPosition(HUMAN), humanMoves);
+                    humanPath.push_back(checkers::SquareOf(sr, sc));
                 }
-            } else if (clicked && !clicked->IsAI()) {
-                if (!playerMultiCapture || (clicked->GetRow() == lastCaptureRow && clicked->GetCol() == lastCaptureCol))
-                    selectedPiece = clicked;
-            }
-        }
 
-        if (currentTurn == AI) {
-            aiWaitTimer += GetFrameTime();
-            if (aiWaitTimer > 1.0f) {
-                bool madeMove = false;
-                for (int r = 0; r < BOARD_SIZE && !madeMove; ++r) {
-                    for (int c = 0; c < BOARD_SIZE && !madeMove; ++c) {
-                        PieceBase* aiPiece = board.GetPiece(r, c);
-                        if (aiPiece && aiPiece->IsAI()) {
-                            int dr[4] = {1, 1, -1, -1};
-                            int dc[4] = {-1, 1, -1, 1};
-                            for (int d = 0; d < 4; ++d) {
-                                if (!aiPiece->IsKing() && dr[d] < 0) continue;
-                                int mr = r + dr[d];
-                                int mc = c + dc[d];
-                                int tr = r + 2 * dr[d];
-                                int tc = c + 2 * dc[d];
-                                if (tr >= 0 && tr < BOARD_SIZE && tc >= 0 && tc < BOARD_SIZE) {
-                                    PieceBase* middle = board.GetPiece(mr, mc);
-                                    if (board.GetPiece(tr, tc) == nullptr && middle && !middle->IsAI()) {
-                                        board.RemovePiece(mr, mc);
-                                        board.MovePiece(r, c, tr, tc);
-                                        aiCaptureRow = tr;
-                                        aiCaptureCol = tc;
-                                        aiMultiCapture = true;
-                                        madeMove = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
+                // The hop is legal if some legal move continues the path taken so far with it
+                int hops = (int)humanPath.size() - 1;
+                bool matched = false, complete = false;
+                for (int i = 0; i < humanMoves.count && target >= 0; ++i) {
+                    const checkers::Move& move = humanMoves.moves[i];
+                    if (move.from != humanPath[0] || move.pathLen <= hops || move.path[hops] != target) continue;
+                    bool samePrefix = true;
+                    for (int h = 0; h < hops; ++h)
+                        if (move.path[h] != humanPath[h + 1]) samePrefix = false;
+                    if (!samePrefix) continue;
+                    matched = true;
+                    if (move.pathLen == hops + 1) complete = true;
                 }
 
-                if (!madeMove && !aiMultiCapture) {
-                    for (int r = 0; r < BOARD_SIZE && !madeMove; ++r) {
-                        for (int c = 0; c < BOARD_SIZE && !madeMove; ++c) {
-                            PieceBase* aiPiece = board.GetPiece(r, c);
-                            if (aiPiece && aiPiece->IsAI()) {
-                                int dr[4] = {1, 1, -1, -1};
-                                int dc[4] = {-1, 1, -1, 1};
-                                for (int d = 0; d < 4; ++d) {
-                                    if (!aiPiece->IsKing() && dr[d] < 0) continue;
-                                    int nr = r + dr[d];
-                                    int nc = c + dc[d];
-                                    if (nr >= 0 && nr < BOARD_SIZE && nc >= 0 && nc < BOARD_SIZE &&
-                                        board.GetPiece(nr, nc) == nullptr) {
-                                        board.MovePiece(r, c, nr, nc);
-                                        madeMove = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
+                if (matched) {
+                    resources.Play(abs(y - sr) == 2 ? captureSound : moveSound);
+                    if (abs(y - sr) == 2) board.RemovePiece((sr + y) / 2, (sc + x) / 2);
+                    board.MovePiece(sr, sc, y, x);
+                    humanPath.push_back(target);
+                    if (complete) {
+                        playerMultiCapture = false;
+                        pieceSelected = false;
+                        humanPath.clear();
+                        currentTurn = AI;
+                    } else {
+                        playerMultiCapture = true;
+                        pieceSelected = board.GetPiece(y, x, selectedPiece);
                     }
-                    currentTurn = HUMAN;
+                } else if (!playerMultiCapture) {
+                    if (humanMoves.count > 0 && humanMoves.moves[0].IsCapture() && abs(y - sr) == 1)
+                        showInvalidMove = true;
+                    pieceSelected = false;
+                    humanPath.clear();
                 }
+            } else if (hasClicked && !clicked.IsAI()) {
+                selectedPiece = clicked;
+                pieceSelected = true;
+            }
+        }
 
-                if (aiMultiCapture && board.CanCapture(board.GetPiece(aiCaptureRow, aiCaptureCol))) {
-                    // Continue AI multi-capture next frame
-                } else if (aiMultiCapture) {
-                    aiMultiCapture = false;
-                    currentTurn = HUMAN;
+        if (currentTurn == AI) {
+            if (!aiTurnStarted) {
+                ai.StartTurn(board.GetPosition(AI));
+                aiTurnStarted = true;
+            }
+            checkers::SearchResult result;
+            if (ai.PollMove(result)) {
+                if (result.hasMove) {
+                    board.ApplyMove(result.bestMove);
+                    resources.Play(result.bestMove.IsCapture() ? captureSound : moveSound);
                 }
-
-                aiWaitTimer = 0;
+                currentTurn = HUMAN;
+                aiTurnStarted = false;
             }
         }
 
@@ -400,10 +337,19 @@ int main() {
             winner = AI;
             gameOver = true;
         }
+        if (gameOver) ai.Stop();
 
+        // The AI's move and the invalid-move message's timeout arrive without input;
+        // pondering runs on its own thread and needs no frames
+        bool waiting = currentTurn == AI || showInvalidMove || gameOver || !resources.IsReady();
+        pacer.Set(waiting ? FRAME_WAITING : FRAME_IDLE);
         EndDrawing();
     }
 
+    ai.Stop();
+    renderer.Unload();
+    resources.Unload();
+    CloseAudioDevice();
     CloseWindow();
     return 0;
 }
@@ -0,0 +1,63 @@
+#pragma once
+// Background searching shared by the Othello and Checkers AIs - no raylib dependency
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Runs a Searcher on a worker thread so the caller's frame loop never blocks.
+// The Searcher (and its transposition table) is only touched by one thread at a time,
+// and keeps its table from one search to the next. SearchLimits needs the engines'
+// stop flag and onIteration callback; SearchResult is what Search returns.
+template <class Searcher, class Position, class SearchLimits, class SearchResult>
+class AsyncSearch {
+    private:
+        Searcher& searcher;
+        std::thread worker;
+        std::atomic<bool> stopFlag{false};
+        std::atomic<bool> finished{true};
+        mutable std::mutex resultMutex;
+        SearchResult latest;
+
+    public:
+        explicit AsyncSearch(Searcher& searcher) : searcher(searcher) {}
+        AsyncSearch(const AsyncSearch&) = delete;
+        AsyncSearch& operator=(const AsyncSearch&) = delete;
+        ~AsyncSearch() { Stop(); }
+
+        // Stops any running search first
+        void Start(const Position& pos, SearchLimits limits) {
+            Stop();
+            stopFlag = false;
+            finished = false;
+            {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                latest = SearchResult();
+            }
+
+            limits.stop = &stopFlag;
+            limits.onIteration = [this](const SearchResult& result) {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                latest = result;
+            };
+            worker = std::thread([this, pos, limits]() {
+                SearchResult result = searcher.Search(pos, limits);
+                std::lock_guard<std::mutex> lock(resultMutex);
+                latest = result;
+                finished = true;
+            });
+        }
+
+        // Blocks until the worker has exited
+        void Stop() {
+            stopFlag = true;
+            if (worker.joinable()) worker.join();
+        }
+
+        bool Finished() const { return finished.load(); }
+
+        // Deepest completed iteration so far
+        SearchResult Latest() const {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            return latest;
+        }
+};
@@ -0,0 +1,123 @@
+#include "EngineProcess.h"
+
+#include <chrono>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+const int QUIT_TIMEOUT_MS = 1000;   // Time an engine gets to act on quit before SIGTERM
+const int TERM_TIMEOUT_MS = 500;    // And then on SIGTERM before SIGKILL
+
+// Reaps pid if it exits within timeoutMs
+static bool WaitForExit(int pid, int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        int reaped = waitpid(pid, nullptr, WNOHANG);
+        if (reaped == pid || reaped < 0) return true;   // Exited, or not ours to wait for any more
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+bool EngineProcess::Start(const std::string& command) {
+    Close();
+    // Close-on-exec, so an engine or any other child started later does not inherit them
+    int input[2], output[2];
+    if (pipe2(input, O_CLOEXEC) != 0) return false;
+    if (pipe2(output, O_CLOEXEC) != 0) {
+        close(input[0]);
+        close(input[1]);
+        return false;
+    }
+
+    pid = fork();
+    if (pid == 0) {
+        dup2(input[0], STDIN_FILENO);
+        dup2(output[1], STDOUT_FILENO);
+        // The shell hands its process over to the engine, so Close signals the engine itself
+        std::string exec = "exec " + command;
+        execl("/bin/sh", "sh", "-c", exec.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    close(input[0]);
+    close(output[1]);
+    if (pid < 0) {
+        close(input[1]);
+        close(output[0]);
+        return false;
+    }
+    toEngine = input[1];
+    fromEngine = output[0];
+    fcntl(fromEngine, F_SETFL, fcntl(fromEngine, F_GETFL) | O_NONBLOCK);
+    signal(SIGPIPE, SIG_IGN);   // A dead engine shows up as a failed Send, not a crash
+    return true;
+}
+
+bool EngineProcess::Send(const std::string& line) {
+    if (!Running()) return false;
+    std::string data = line + "\n";
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = write(toEngine, data.data() + written, data.size() - written);
+        if (n <= 0) {
+            Close();
+            return false;
+        }
+        written += (size_t)n;
+    }
+    return true;
+}
+
+bool EngineProcess::PollLine(std::string& line) {
+    char buffer[4096];
+    while (Running()) {
+        ssize_t n = read(fromEngine, buffer, sizeof(buffer));
+        if (n > 0) pending.append(buffer, (size_t)n);
+        else {
+            if (n == 0) Close();    // The engine exited; hand out what it already said
+            break;
+        }
+    }
+
+    size_t end = pending.find('\n');
+    if (end == std::string::npos) return false;
+    line = pending.substr(0, end);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    pending.erase(0, end + 1);
+    return true;
+}
+
+void EngineProcess::Close() {
+    if (pid <= 0) return;
+    const char quit[] = "quit\n";
+    if (write(toEngine, quit, sizeof(quit) - 1) < 0) {}     // It may already be gone
+    close(toEngine);
+    close(fromEngine);
+    // An engine that ignores quit must not hold up the game's exit
+    if (!WaitForExit(pid, QUIT_TIMEOUT_MS)) {
+        kill(pid, SIGTERM);
+        if (!WaitForExit(pid, TERM_TIMEOUT_MS)) {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+    }
+    pid = -1;
+    toEngine = fromEngine = -1;
+}
+
+#else
+
+bool EngineProcess::Start(const std::string&) { return false; }
+bool EngineProcess::Send(const std::string&) { return false; }
+bool EngineProcess::PollLine(std::string&) { return false; }
+void EngineProcess::Close() {}
+
+#endif
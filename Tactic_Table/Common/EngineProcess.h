@@ -0,0 +1,26 @@
+#pragma once
+// Runs an engine such as tactic_engine as a child process and exchanges protocol lines
+// with it. Nothing here blocks, so a game can poll it once per frame while the engine
+// searches on another core. POSIX only; elsewhere Start() fails and callers keep their
+// in-process AI.
+#include <string>
+
+class EngineProcess {
+    public:
+        EngineProcess() {}
+        EngineProcess(const EngineProcess&) = delete;
+        EngineProcess& operator=(const EngineProcess&) = delete;
+        ~EngineProcess() { Close(); }
+
+        bool Start(const std::string& command);     // Run through /bin/sh, e.g. "./tactic_engine othello"
+        bool Running() const { return pid > 0; }
+        bool Send(const std::string& line);         // Newline added; false once the engine has gone
+        bool PollLine(std::string& line);           // Next complete output line, if one has arrived
+        void Close();                               // Sends quit and reaps the process, killing it if it lingers
+
+    private:
+        int pid = -1;
+        int toEngine = -1;          // Write end of the engine's stdin
+        int fromEngine = -1;        // Non-blocking read end of its stdout
+        std::string pending;        // Output read but not yet split into lines
+};
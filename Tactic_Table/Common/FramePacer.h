@@ -0,0 +1,45 @@
+#pragma once
+// Frame pacing for the raylib games. Static screens stop redrawing until there is input,
+// so an idle window costs next to no CPU; animations get the full frame rate, and timers
+// or background work (AI search, asset loading) get a slow tick to notice when they finish.
+#include "raylib.h"
+#include <algorithm>
+
+// Ordered, so the busiest of several sources is std::max of them
+enum FrameActivity {
+    FRAME_IDLE,         // Nothing changes without input: sleep until an event arrives
+    FRAME_WAITING,      // A timer or worker thread will change the screen: poll slowly
+    FRAME_ANIMATING,    // Something is moving: every frame
+};
+
+class FramePacer {
+    public:
+        static const int ANIMATION_FPS = 60;
+        static const int WAITING_FPS = 15;
+        static constexpr float MAX_FRAME_TIME = 0.1f;
+
+        // Call once per frame, before EndDrawing(), with what the next frame needs. The
+        // frame after a wake-up is always drawn without waiting, so whatever the waking
+        // event changed (a new screen, a toggled option) is shown before sleeping again.
+        void Set(FrameActivity activity) {
+            bool wait = activity == FRAME_IDLE && !waiting;
+            if (wait != waiting) {
+                if (wait) EnableEventWaiting();
+                else DisableEventWaiting();
+                waiting = wait;
+            }
+            int fps = activity == FRAME_WAITING ? WAITING_FPS : ANIMATION_FPS;
+            if (fps != targetFps) {
+                SetTargetFPS(fps);
+                targetFps = fps;
+            }
+        }
+
+        // Frame time for timers and animations: the first frame after a long sleep would
+        // otherwise finish them in one step
+        static float FrameTime() { return std::min(GetFrameTime(), MAX_FRAME_TIME); }
+
+    private:
+        bool waiting = false;
+        int targetFps = ANIMATION_FPS;      // The games start with SetTargetFPS(60)
+};
@@ -0,0 +1,206 @@
+#include "PositionCache.h"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+namespace {
+
+const char MAGIC[8] = {'T', 'T', 'C', 'A', 'C', 'H', 'E', '1'};
+
+// First 64 bytes of the file; the buckets follow
+struct Header {
+    char magic[8];
+    char game[16];
+    uint64_t bucketCount;
+    uint64_t generation;
+    uint8_t reserved[24];
+};
+static_assert(sizeof(Header) == 64, "the buckets start on a cache line");
+
+const size_t BUCKET_BYTES = 64;
+const int MAX_AGE_PENALTY = 64;     // Generations after which an entry is as good as empty
+
+uint64_t Pack(const CachedPosition& entry, uint64_t generation) {
+    return (uint64_t)(uint16_t)(int16_t)entry.score
+         | (uint64_t)(uint8_t)entry.depth << 16
+         | (uint64_t)(uint8_t)entry.flag << 24
+         | (uint64_t)(uint8_t)entry.move << 32
+         | (generation & 0xFFFF) << 40;
+}
+
+CachedPosition Unpack(uint64_t data) {
+    CachedPosition entry;
+    entry.score = (int16_t)(uint16_t)data;
+    entry.depth = (uint8_t)(data >> 16);
+    entry.flag = (uint8_t)(data >> 24);
+    entry.move = (uint8_t)(data >> 32);
+    return entry;
+}
+
+int DepthOf(uint64_t data) { return (uint8_t)(data >> 16); }
+uint64_t GenerationOf(uint64_t data) { return (data >> 40) & 0xFFFF; }
+
+} // namespace
+
+bool PositionCache::Open(const std::string& path, const std::string& game, int sizeMB) {
+    Close();
+    // Not inherited by an engine process started later, which would hold the lock for good
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    // One writer per file: a second game or engine process runs without the cache
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        close(fd);
+        fd = -1;
+        return false;
+    }
+
+    // Keep the file if it is ours and intact, whatever size it was made with
+    Header header = {};
+    struct stat info;
+    bool valid = fstat(fd, &info) == 0 && pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)
+              && memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0
+              && strncmp(header.game, game.c_str(), sizeof(header.game)) == 0
+              && header.bucketCount > 0 && (header.bucketCount & (header.bucketCount - 1)) == 0
+              && (uint64_t)info.st_size == sizeof(Header) + header.bucketCount * BUCKET_BYTES;
+    if (!valid) {
+        uint64_t buckets = 1;
+        while (buckets * 2 * BUCKET_BYTES <= (uint64_t)sizeMB * 1024 * 1024) buckets *= 2;
+        header = Header();
+        memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        strncpy(header.game, game.c_str(), sizeof(header.game) - 1);
+        header.bucketCount = buckets;
+        // Truncating to zero first leaves every slot empty (and the file sparse)
+        if (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t)(sizeof(Header) + buckets * BUCKET_BYTES)) != 0
+            || pwrite(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+            close(fd);
+            fd = -1;
+            return false;
+        }
+    }
+
+    mappingSize = sizeof(Header) + header.bucketCount * BUCKET_BYTES;
+    mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        close(fd);
+        fd = -1;
+        return false;
+    }
+
+    Header* mapped = (Header*)mapping;
+    generation = ++mapped->generation;
+    bucketMask = header.bucketCount - 1;
+    closing = false;
+    slots = (Slot*)((char*)mapping + sizeof(Header));
+    writer = std::thread(&PositionCache::WriterLoop, this);
+    return true;
+}
+
+void PositionCache::Close() {
+    if (!IsOpen()) return;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        closing = true;
+    }
+    queueChanged.notify_all();
+    writer.join();
+
+    // The kernel writes the dirty pages back in its own time, even after we exit
+    munmap(mapping, mappingSize);
+    close(fd);
+    mapping = nullptr;
+    slots = nullptr;
+    fd = -1;
+}
+
+bool PositionCache::Probe(uint64_t key, CachedPosition& entry) const {
+    if (!IsOpen()) return false;
+    const Slot* bucket = slots + (key & bucketMask) * BUCKET_SLOTS;
+    for (int i = 0; i < BUCKET_SLOTS; ++i) {
+        uint64_t data = __atomic_load_n(&bucket[i].data, __ATOMIC_RELAXED);
+        uint64_t check = __atomic_load_n(&bucket[i].check, __ATOMIC_RELAXED);
+        if (data != 0 && (check ^ data) == key) {
+            entry = Unpack(data);
+            return true;
+        }
+    }
+    return false;
+}
+
+void PositionCache::Store(uint64_t key, const CachedPosition& entry) {
+    if (!IsOpen() || entry.depth < 1) return;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (pending.size() >= MAX_PENDING) return;
+        pending.push_back({key, Pack(entry, generation)});
+    }
+    queueChanged.notify_one();
+}
+
+void PositionCache::Flush() {
+    if (!IsOpen()) return;
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueWritten.wait(lock, [this]() { return pending.empty() && !writing; });
+}
+
+void PositionCache::WriterLoop() {
+    std::vector<Slot> batch;
+    std::unique_lock<std::mutex> lock(queueMutex);
+    while (true) {
+        queueChanged.wait(lock, [this]() { return closing || !pending.empty(); });
+        if (pending.empty()) break;     // Closing, and everything is written
+        batch.swap(pending);
+        writing = true;
+        lock.unlock();
+        for (const Slot& store : batch) Write(store.check, store.data);
+        batch.clear();
+        lock.lock();
+        writing = false;
+        queueWritten.notify_all();
+    }
+}
+
+// Only the writer thread changes slots. Same key: keep the deeper search. Otherwise take
+// an empty slot, or the one whose depth is worth least once its age is counted against it.
+void PositionCache::Write(uint64_t key, uint64_t data) {
+    Slot* bucket = slots + (key & bucketMask) * BUCKET_SLOTS;
+    Slot* victim = nullptr;
+    int victimValue = 0;
+    for (int i = 0; i < BUCKET_SLOTS; ++i) {
+        Slot& slot = bucket[i];
+        if (slot.data != 0 && (slot.check ^ slot.data) == key) {
+            // A shallower result never replaces a deeper one; it only marks it as still in use
+            if (DepthOf(data) < DepthOf(slot.data))
+                data = (slot.data & ~(0xFFFFULL << 40)) | (generation & 0xFFFF) << 40;
+            victim = &slot;
+            break;
+        }
+        int age = (int)((generation - GenerationOf(slot.data)) & 0xFFFF);
+        int value = slot.data == 0 ? -1000 : DepthOf(slot.data) - 4 * std::min(age, MAX_AGE_PENALTY);
+        if (!victim || value < victimValue) {
+            victim = &slot;
+            victimValue = value;
+        }
+    }
+    __atomic_store_n(&victim->data, data, __ATOMIC_RELAXED);
+    __atomic_store_n(&victim->check, key ^ data, __ATOMIC_RELAXED);
+}
+
+#else
+
+bool PositionCache::Open(const std::string&, const std::string&, int) { return false; }
+void PositionCache::Close() {}
+bool PositionCache::Probe(uint64_t, CachedPosition&) const { return false; }
+void PositionCache::Store(uint64_t, const CachedPosition&) {}
+void PositionCache::Flush() {}
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+// Deeply searched positions kept in a memory-mapped file, so an AI starts every session
+// with what earlier games already worked out. Opening the file maps it without reading
+// it; lookups are lock-free reads of the mapping, and stores are queued for a writer
+// thread so a search never waits on the disk. The file has a fixed number of slots:
+// when a bucket is full the shallowest, oldest entry gives way. POSIX only; elsewhere
+// Open() fails and the searches run without it.
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct CachedPosition {
+    int score = 0;
+    int depth = 0;          // 1..255 plies searched below the position
+    int flag = 0;           // The engine's own bound flag, stored as given
+    int move = 0;           // 0..255 in the engine's own move numbering
+};
+
+class PositionCache {
+    public:
+        PositionCache() {}
+        PositionCache(const PositionCache&) = delete;
+        PositionCache& operator=(const PositionCache&) = delete;
+        ~PositionCache() { Close(); }
+
+        // Maps path, creating it with sizeMB of slots if it is missing or was written for
+        // another game. False if it cannot be mapped or another process has it open.
+        bool Open(const std::string& path, const std::string& game, int sizeMB = 64);
+        bool IsOpen() const { return slots != nullptr; }
+        void Close();                                       // Writes out what is queued, then unmaps
+
+        bool Probe(uint64_t key, CachedPosition& entry) const;     // Safe from any thread
+        void Store(uint64_t key, const CachedPosition& entry);     // Queued; dropped when the queue is full
+        void Flush();                                       // Blocks until every queued store is in the file
+
+        uint64_t Generation() const { return generation; }  // Bumped on every Open
+
+    private:
+        struct Slot {
+            uint64_t check;     // key ^ data, so a slot torn by a crash or a racing write never matches
+            uint64_t data;      // Packed CachedPosition and the generation it was stored in
+        };
+        static const int BUCKET_SLOTS = 4;                  // One 64-byte cache line
+        static const size_t MAX_PENDING = 1 << 16;
+
+        int fd = -1;
+        void* mapping = nullptr;
+        size_t mappingSize = 0;
+        Slot* slots = nullptr;
+        uint64_t bucketMask = 0;
+        uint64_t generation = 0;
+
+        std::thread writer;
+        std::mutex queueMutex;
+        std::condition_variable queueChanged;               // Wakes the writer
+        std::condition_variable queueWritten;               // Wakes Flush
+        std::vector<Slot> pending;                          // {key, data} waiting for the writer
+        bool writing = false;                               // The writer holds a batch taken from pending
+        bool closing = false;
+
+        void WriterLoop();
+        void Write(uint64_t key, uint64_t data);
+};
@@ -0,0 +1,162 @@
+#include "ResourceCache.h"
+
+const int FONT_GLYPH_COUNT = 95;    // Printable ASCII, as raylib's LoadFont uses
+const int FONT_GLYPH_PADDING = 4;
+
+ResourceCache::~ResourceCache() {
+    Unload();
+    for (Entry* entry : entries) delete entry;
+}
+
+// GPU and audio handles need the window and device, so this runs before CloseWindow();
+// anything still only decoded is freed on the CPU side
+void ResourceCache::Unload() {
+    stopping = true;
+    if (worker.joinable()) worker.join();
+    for (Entry* entry : entries) {
+        int state = entry->state.load();
+        if (state == LOADED) {
+            if (entry->kind == SOUND) UnloadSound(entry->sound);
+            else if (entry->kind == TEXTURE) UnloadTexture(entry->texture);
+            else UnloadFont(entry->font);
+        } else if (state == DECODED) {
+            if (entry->kind == SOUND) UnloadWave(entry->wave);
+            else UnloadImage(entry->image);
+            if (entry->kind == FONT) {
+                UnloadFontData(entry->glyphs, FONT_GLYPH_COUNT);
+                MemFree(entry->glyphRecs);
+            }
+        }
+        entry->state = FAILED;
+    }
+}
+
+int ResourceCache::Request(Kind kind, const std::string& path, int fontSize) {
+    if (started) {
+        TraceLog(LOG_WARNING, "RESOURCES: %s requested after loading started", path.c_str());
+        return -1;
+    }
+    for (int i = 0; i < (int)entries.size(); ++i)
+        if (entries[i]->kind == kind && entries[i]->path == path && entries[i]->fontSize == fontSize) return i;
+    entries.push_back(new Entry(kind, path, fontSize));
+    return (int)entries.size() - 1;
+}
+
+SoundHandle ResourceCache::RequestSound(const std::string& path) { return { Request(SOUND, path, 0) }; }
+TextureHandle ResourceCache::RequestTexture(const std::string& path) { return { Request(TEXTURE, path, 0) }; }
+FontHandle ResourceCache::RequestFont(const std::string& path, int fontSize) { return { Request(FONT, path, fontSize) }; }
+
+void ResourceCache::StartLoading() {
+    if (started) return;
+    started = true;
+    worker = std::thread([this]() { DecodeAll(); });
+}
+
+void ResourceCache::DecodeAll() {
+    for (Entry* entry : entries) {
+        if (stopping) return;
+        Decode(*entry);
+    }
+}
+
+// Worker thread: file I/O and decoding only, nothing that touches the GPU or audio device
+void ResourceCache::Decode(Entry& entry) {
+    if (!FileExists(entry.path.c_str())) {
+        TraceLog(LOG_WARNING, "RESOURCES: %s not found, continuing without it", entry.path.c_str());
+        entry.state = FAILED;
+        return;
+    }
+
+    bool ok = false;
+    if (entry.kind == SOUND) {
+        entry.wave = LoadWave(entry.path.c_str());
+        ok = entry.wave.data != nullptr;
+    } else if (entry.kind == TEXTURE) {
+        entry.image = LoadImage(entry.path.c_str());
+        ok = entry.image.data != nullptr;
+    } else {
+        int size = 0;
+        unsigned char* data = LoadFileData(entry.path.c_str(), &size);
+        if (data) {
+            entry.glyphs = LoadFontData(data, size, entry.fontSize, nullptr, FONT_GLYPH_COUNT, FONT_DEFAULT);
+            if (entry.glyphs) {
+                entry.image = GenImageFontAtlas(entry.glyphs, &entry.glyphRecs, FONT_GLYPH_COUNT, entry.fontSize,
+                                                FONT_GLYPH_PADDING, 0);
+                ok = entry.image.data != nullptr;
+            }
+            UnloadFileData(data);
+        }
+    }
+    entry.state = ok ? DECODED : FAILED;
+}
+
+// Main thread: hand decoded data to the GPU or audio device and free the CPU copy
+void ResourceCache::Upload(Entry& entry) {
+    if (entry.kind == SOUND) {
+        entry.sound = LoadSoundFromWave(entry.wave);
+        UnloadWave(entry.wave);
+    } else if (entry.kind == TEXTURE) {
+        entry.texture = LoadTextureFromImage(entry.image);
+        UnloadImage(entry.image);
+    } else {
+        entry.font.baseSize = entry.fontSize;
+        entry.font.glyphCount = FONT_GLYPH_COUNT;
+        entry.font.glyphPadding = FONT_GLYPH_PADDING;
+        entry.font.glyphs = entry.glyphs;
+        entry.font.recs = entry.glyphRecs;
+        entry.font.texture = LoadTextureFromImage(entry.image);
+        UnloadImage(entry.image);
+    }
+    entry.state = LOADED;
+}
+
+void ResourceCache::Update() {
+    if (!started || finished == (int)entries.size()) return;
+
+    int uploads = 0;
+    finished = 0;
+    for (Entry* entry : entries) {
+        int state = entry->state.load();
+        if (state == DECODED && uploads < MAX_UPLOADS_PER_FRAME) {
+            // Sounds need the audio device; without one they are dropped rather than retried forever
+            if (entry->kind == SOUND && !IsAudioDeviceReady()) {
+                UnloadWave(entry->wave);
+                entry->state = FAILED;
+            } else {
+                Upload(*entry);
+                uploads++;
+            }
+            state = entry->state.load();
+        }
+        if (state == LOADED || state == FAILED) finished++;
+    }
+}
+
+bool ResourceCache::IsReady() const {
+    return started && finished == (int)entries.size();
+}
+
+float ResourceCache::Progress() const {
+    return entries.empty() ? 1.0f : (float)finished / entries.size();
+}
+
+const ResourceCache::Entry* ResourceCache::Loaded(int index, Kind kind) const {
+    if (index < 0 || index >= (int)entries.size()) return nullptr;
+    const Entry* entry = entries[index];
+    if (entry->kind != kind || entry->state.load() != LOADED) return nullptr;
+    return entry;
+}
+
+void ResourceCache::Play(SoundHandle sound) const {
+    if (const Entry* entry = Loaded(sound.index, SOUND)) PlaySound(entry->sound);
+}
+
+const Texture2D* ResourceCache::GetTexture(TextureHandle texture) const {
+    const Entry* entry = Loaded(texture.index, TEXTURE);
+    return entry ? &entry->texture : nullptr;
+}
+
+Font ResourceCache::GetFont(FontHandle font) const {
+    const Entry* entry = Loaded(font.index, FONT);
+    return entry ? entry->font : GetFontDefault();
+}
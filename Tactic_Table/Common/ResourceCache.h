@@ -0,0 +1,79 @@
+#pragma once
+// Shared sound, texture and font cache for the games, loaded in the background at startup
+#include "raylib.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Handles are plain indices: cheap to copy into boards and game objects, and safe to
+// use before their asset has arrived (playing or drawing does nothing until then)
+struct SoundHandle { int index = -1; };
+struct TextureHandle { int index = -1; };
+struct FontHandle { int index = -1; };
+
+// Request every asset, call StartLoading() once the window and audio device are open,
+// then Update() once per frame. File reading and decoding (WAV/OGG, PNG, glyph
+// rasterising) happen on a worker thread; the main thread only does the GPU and audio
+// uploads, a few per frame, so menus stay responsive while assets stream in.
+// Missing files are logged once and their handles stay silent.
+class ResourceCache {
+    public:
+        static const int MAX_UPLOADS_PER_FRAME = 4;
+
+        ResourceCache() {}
+        ResourceCache(const ResourceCache&) = delete;
+        ResourceCache& operator=(const ResourceCache&) = delete;
+        ~ResourceCache();
+
+        // Register assets; only before StartLoading. The same path returns the same handle.
+        SoundHandle RequestSound(const std::string& path);
+        TextureHandle RequestTexture(const std::string& path);
+        FontHandle RequestFont(const std::string& path, int fontSize);
+
+        void StartLoading();
+        void Update();                  // Main thread: uploads what the worker has decoded
+        void Unload();                  // Before CloseWindow(); handles go silent afterwards
+        bool IsReady() const;           // Every request loaded or given up on
+        float Progress() const;         // 0..1, for a loading indicator
+
+        void Play(SoundHandle sound) const;
+        const Texture2D* GetTexture(TextureHandle texture) const;  // nullptr until loaded
+        Font GetFont(FontHandle font) const;                        // raylib's default until loaded
+
+    private:
+        enum Kind { SOUND, TEXTURE, FONT };
+        enum State { QUEUED, DECODED, LOADED, FAILED };
+
+        struct Entry {
+            Kind kind;
+            std::string path;
+            int fontSize = 0;
+            std::atomic<int> state{QUEUED};     // Worker moves QUEUED to DECODED or FAILED
+
+            // Decoded on the worker
+            Wave wave = {};
+            Image image = {};
+            GlyphInfo* glyphs = nullptr;
+            Rectangle* glyphRecs = nullptr;
+
+            // Uploaded on the main thread
+            Sound sound = {};
+            Texture2D texture = {};
+            Font font = {};
+
+            Entry(Kind kind, const std::string& path, int fontSize) : kind(kind), path(path), fontSize(fontSize) {}
+        };
+
+        std::vector<Entry*> entries;    // Pointers, so the worker's view never moves
+        std::thread worker;
+        std::atomic<bool> stopping{false};
+        bool started = false;
+        int finished = 0;               // LOADED or FAILED, counted on the main thread
+
+        int Request(Kind kind, const std::string& path, int fontSize);
+        void DecodeAll();
+        void Decode(Entry& entry);
+        void Upload(Entry& entry);
+        const Entry* Loaded(int index, Kind kind) const;
+};
@@ -0,0 +1,261 @@
+// Headless Othello and Checkers engine speaking a line-based protocol on stdin/stdout
+//
+//   tactic_engine [othello|checkers]
+//
+// Commands (one per line; the game defaults to othello):
+//   game othello|checkers           switch game and go back to the start position
+//   newgame                         start position, empty transposition table
+//   position startpos [moves ...]   set the position, then play the listed moves
+//   position TEXT [moves ...]       TEXT as FromString takes it ("b:..." / "h:...")
+//   go [depth N] [movetime MS] [nodes N] [infinite]
+//                                   search in the background; with no limit, depth 64.
+//                                   infinite drops the other limits and holds bestmove
+//                                   back until stop, even if the search ends sooner
+//   stop                            end the search now; bestmove follows
+//   weights FILE                    Othello evaluation weights from othello_trainer;
+//                                   send newgame after it so no old scores are reused
+//   cache FILE|off                  keep deep results in FILE (a PositionCache) for this
+//                                   game until off, game or quit; one process per file
+//   isready                         answered with readyok once earlier commands are done
+//   d                               print the position as TEXT
+//   quit
+//
+// While searching, one line per completed depth:
+//   info depth D score S nodes N nps R time MS pv MOVE ...
+// and when the search ends, however it ends:
+//   bestmove MOVE        ("none" when the side to move has no move at all)
+//
+// Moves use each engine's MoveToString form ("d3" or "pass"; "21-17" or "22x15x8").
+// Scores are from the side to move. Every engine process is independent, so a
+// tournament manager can run one per core.
+//
+// Build: cmake target tactic_engine, or g++ -O2 -std=c++17 -pthread -I../Othello -I../Checkers -I../Common
+//        ../Othello/OthelloEngine.cpp ../Othello/OthelloBatch.cpp ../Checkers/CheckersEngine.cpp
+//        ../Common/PositionCache.cpp tactic_engine.cpp -o tactic_engine
+
+#include "CheckersEngine.h"
+#include "OthelloEngine.h"
+#include "PositionCache.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Info and bestmove lines come from the search thread, replies from the main thread
+static std::mutex outputMutex;
+
+static void Send(const std::string& line) {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    std::cout << line << std::endl;
+}
+
+// What the session needs from each engine namespace
+struct OthelloGame {
+    typedef othello::Position Position;
+    typedef othello::Searcher Searcher;
+    typedef othello::SearchLimits SearchLimits;
+    typedef othello::SearchResult SearchResult;
+    typedef int Move;
+    static const char* Name() { return "othello"; }
+    static Position StartPosition() { return othello::StartPosition(); }
+    static bool FromString(const std::string& text, Position& pos) { return othello::FromString(text, pos); }
+    static std::string ToString(const Position& pos) { return othello::ToString(pos); }
+    static bool ParseMove(const Position& pos, const std::string& text, Move& move) { return othello::ParseMove(pos, text, move); }
+    static std::string MoveToString(const Move& move) { return othello::MoveToString(move); }
+    static Position MakeMove(const Position& pos, const Move& move) { return othello::MakeMove(pos, move); }
+    static void UsePositionCache(PositionCache* cache) { othello::UsePositionCache(cache); }
+};
+
+struct CheckersGame {
+    typedef checkers::Position Position;
+    typedef checkers::Searcher Searcher;
+    typedef checkers::SearchLimits SearchLimits;
+    typedef checkers::SearchResult SearchResult;
+    typedef checkers::Move Move;
+    static const char* Name() { return "checkers"; }
+    static Position StartPosition() { return checkers::StartPosition(); }
+    static bool FromString(const std::string& text, Position& pos) { return checkers::FromString(text, pos); }
+    static std::string ToString(const Position& pos) { return checkers::ToString(pos); }
+    static bool ParseMove(const Position& pos, const std::string& text, Move& move) { return checkers::ParseMove(pos, text, move); }
+    static std::string MoveToString(const Move& move) { return checkers::MoveToString(move); }
+    static Position MakeMove(const Position& pos, const Move& move) { return checkers::MakeMove(pos, move); }
+    static void UsePositionCache(PositionCache* cache) { checkers::UsePositionCache(cache); }
+};
+
+class Session {
+    public:
+        virtual ~Session() {}
+        virtual const char* Name() const = 0;
+        virtual bool SetPosition(std::istringstream& args) = 0;
+        virtual void Go(std::istringstream& args) = 0;
+        virtual void Stop() = 0;            // Blocks until bestmove has been sent
+        virtual void NewGame() = 0;
+        virtual bool SetCache(const std::string& path) = 0;     // "off" closes it
+        virtual std::string PositionText() const = 0;
+};
+
+template <class Game>
+class GameSession : public Session {
+    private:
+        typename Game::Searcher searcher;
+        typename Game::Position position = Game::StartPosition();
+        std::thread worker;
+        std::atomic<bool> stopFlag{false};
+        std::mutex stopMutex;
+        std::condition_variable stopRequested;      // Wakes a finished infinite search
+        PositionCache cache;
+
+        static std::string InfoLine(const typename Game::SearchResult& result) {
+            std::ostringstream line;
+            double seconds = result.elapsedMs / 1000.0;
+            line << "info depth " << result.depth << " score " << result.score << " nodes " << result.nodes
+                 << " nps " << (uint64_t)(seconds > 0 ? result.nodes / seconds : 0) << " time " << (uint64_t)result.elapsedMs;
+            if (!result.pv.empty()) {
+                line << " pv";
+                for (const typename Game::Move& move : result.pv) line << " " << Game::MoveToString(move);
+            }
+            return line.str();
+        }
+
+    public:
+        ~GameSession() {
+            Stop();
+            if (cache.IsOpen()) Game::UsePositionCache(nullptr);
+        }
+
+        const char* Name() const override { return Game::Name(); }
+
+        bool SetPosition(std::istringstream& args) override {
+            Stop();
+            std::string token;
+            if (!(args >> token)) return false;
+            typename Game::Position pos = Game::StartPosition();
+            if (token != "startpos" && !Game::FromString(token, pos)) return false;
+
+            if (args >> token) {
+                if (token != "moves") return false;
+                while (args >> token) {
+                    typename Game::Move move;
+                    if (!Game::ParseMove(pos, token, move)) return false;
+                    pos = Game::MakeMove(pos, move);
+                }
+            }
+            position = pos;
+            return true;
+        }
+
+        void Go(std::istringstream& args) override {
+            Stop();
+            typename Game::SearchLimits limits;
+            std::string token;
+            bool infinite = false;
+            while (args >> token) {
+                if (token == "depth") args >> limits.maxDepth;
+                else if (token == "movetime") args >> limits.maxTimeMs;
+                else if (token == "nodes") args >> limits.maxNodes;
+                else if (token == "infinite") infinite = true;
+                else Send("info string ignoring unknown go option " + token);
+            }
+            if (infinite) limits = typename Game::SearchLimits();
+            if (limits.maxDepth < 1) limits.maxDepth = 1;
+
+            stopFlag = false;
+            limits.stop = &stopFlag;
+            limits.onIteration = [](const typename Game::SearchResult& result) { Send(InfoLine(result)); };
+            typename Game::Position root = position;
+            worker = std::thread([this, root, limits, infinite]() {
+                typename Game::SearchResult result = searcher.Search(root, limits);
+                // A search can finish by itself (a proven result, no deeper plies left)
+                if (infinite) {
+                    std::unique_lock<std::mutex> lock(stopMutex);
+                    stopRequested.wait(lock, [this]() { return stopFlag.load(); });
+                }
+                Send("bestmove " + (result.hasMove ? Game::MoveToString(result.bestMove) : std::string("none")));
+            });
+        }
+
+        void Stop() override {
+            {
+                std::lock_guard<std::mutex> lock(stopMutex);
+                stopFlag = true;
+            }
+            stopRequested.notify_all();
+            if (worker.joinable()) worker.join();
+        }
+
+        void NewGame() override {
+            Stop();
+            searcher.ClearTable();
+            position = Game::StartPosition();
+        }
+
+        bool SetCache(const std::string& path) override {
+            Stop();
+            Game::UsePositionCache(nullptr);
+            cache.Close();
+            if (path == "off") return true;
+            if (!cache.Open(path, Game::Name())) return false;
+            Game::UsePositionCache(&cache);
+            return true;
+        }
+
+        std::string PositionText() const override { return Game::ToString(position); }
+};
+
+static std::unique_ptr<Session> MakeSession(const std::string& game) {
+    if (game == "othello") return std::unique_ptr<Session>(new GameSession<OthelloGame>());
+    if (game == "checkers") return std::unique_ptr<Session>(new GameSession<CheckersGame>());
+    return nullptr;
+}
+
+int main(int argc, char** argv) {
+    std::unique_ptr<Session> session = MakeSession(argc > 1 ? argv[1] : "othello");
+    if (argc > 2 || !session) {
+        std::cerr << "Usage: " << argv[0] << " [othello|checkers]\n";
+        return 2;
+    }
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream args(line);
+        std::string command;
+        if (!(args >> command)) continue;
+
+        if (command == "quit") break;
+        else if (command == "isready") Send("readyok");
+        else if (command == "stop") session->Stop();
+        else if (command == "go") session->Go(args);
+        else if (command == "newgame") session->NewGame();
+        else if (command == "d") Send(session->PositionText());
+        else if (command == "weights") {
+            std::string path;
+            args >> path;
+            session->Stop();
+            if (!othello::LoadWeights(path)) Send("info string cannot read weights " + path);
+        }
+        else if (command == "cache") {
+            std::string path;
+            args >> path;
+            if (path.empty() || !session->SetCache(path)) Send("info string cannot open cache " + path);
+        }
+        else if (command == "position") {
+            if (!session->SetPosition(args)) Send("info string bad position: " + line);
+        } else if (command == "game") {
+            std::string game;
+            args >> game;
+            std::unique_ptr<Session> next = MakeSession(game);
+            if (next) session = std::move(next);
+            else Send("info string unknown game " + game);
+        } else {
+            Send("info string unknown command " + command);
+        }
+    }
+    session->Stop();
+    return 0;
+}
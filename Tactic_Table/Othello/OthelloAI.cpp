@@ -0,0 +1,26 @@
+#include "OthelloAI.h"
+
+namespace othello {
+
+// --- MoveAnalysis ---
+
+void MoveAnalysis::Update(const Position& pos) {
+    if (running && root == pos) return;
+    root = pos;
+    SearchLimits limits;
+    limits.maxDepth = maxDepth;
+    limits.allMoves = true;
+    search.Start(pos, limits);
+    running = true;
+}
+
+void MoveAnalysis::Stop() {
+    search.Stop();
+    running = false;
+}
+
+SearchResult MoveAnalysis::Latest() const {
+    return running ? search.Latest() : SearchResult();
+}
+
+} // namespace othello
@@ -0,0 +1,32 @@
+#pragma once
+
+// Background searching for the Othello AI and analysis - no raylib dependency
+#include "OthelloEngine.h"
+#include "AsyncSearch.h"
+
+namespace othello {
+
+// The shared worker-thread search from Common, over this engine's types
+using AsyncSearch = ::AsyncSearch<Searcher, Position, SearchLimits, SearchResult>;
+
+// Scores every legal move of a position in the background, deepening until stopped.
+// Call Update() each frame with the position on the board: a new position restarts the
+// search (the transposition table stays warm), the same one just lets it run on.
+class MoveAnalysis {
+    private:
+        Searcher searcher;
+        AsyncSearch search;
+        Position root;
+        bool running = false;
+        int maxDepth;
+
+    public:
+        explicit MoveAnalysis(int maxDepth = 20) : search(searcher), maxDepth(maxDepth) {}
+
+        void Update(const Position& pos);
+        void Stop();                        // Until the next Update
+        SearchResult Latest() const;        // Empty until depth 1 of the current position is done
+        bool Searching() const { return running && !search.Finished(); }   // Still deepening
+};
+
+} // namespace othello
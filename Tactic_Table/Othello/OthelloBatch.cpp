@@ -0,0 +1,182 @@
+#include "OthelloEngine.h"
+
+// Batched child generation and leaf scoring. The AVX2 kernels are compiled with a
+// per-function target attribute and only called after a runtime CPU check, so the
+// library still builds and runs with default compiler flags on any x86-64 machine.
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define OTHELLO_HAS_AVX2_KERNEL 1
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace othello {
+
+static BatchKernel DetectKernel() {
+#ifdef OTHELLO_HAS_AVX2_KERNEL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return BATCH_AVX2;
+#endif
+    return BATCH_SCALAR;
+}
+
+static BatchKernel activeKernel = DetectKernel();
+
+BatchKernel ActiveBatchKernel() { return activeKernel; }
+
+bool SetBatchKernel(BatchKernel kernel) {
+    if (kernel == BATCH_AVX2 && DetectKernel() != BATCH_AVX2) return false;
+    activeKernel = kernel;
+    return true;
+}
+
+// --- Scalar ---
+
+static void GenerateChildrenScalar(const Position& pos, const MoveList& list, Position children[]) {
+    for (int i = 0; i < list.count; ++i) children[i] = MakeMove(pos, list.moves[i]);
+}
+
+static void ScoreLeavesScalar(const Position positions[], int count, int scores[]) {
+    for (int i = 0; i < count; ++i) scores[i] = ScoreLeaf(positions[i]);
+}
+
+// --- AVX2: one position per 64-bit lane ---
+
+#ifdef OTHELLO_HAS_AVX2_KERNEL
+
+static const uint64_t INNER_COLS = 0x7E7E7E7E7E7E7E7EULL;  // Drops columns a and h
+
+// A direction is a shift plus the opponent mask that stops runs wrapping across rows:
+// only vertical runs may include edge-column discs
+struct Direction {
+    int shift;
+    bool left;
+    bool vertical;
+};
+static const Direction DIRECTIONS[8] = {
+    {1, true, false}, {1, false, false},    // East, west
+    {8, true, true},  {8, false, true},     // South, north
+    {9, true, false}, {7, true, false},     // South-east, south-west
+    {7, false, false}, {9, false, false},   // North-east, north-west
+};
+
+AVX2_TARGET static inline __m256i Shift(__m256i b, const Direction& dir) {
+    __m128i count = _mm_cvtsi32_si128(dir.shift);
+    return dir.left ? _mm256_sll_epi64(b, count) : _mm256_srl_epi64(b, count);
+}
+
+// Squares reached by sliding from seeds over at least one opponent disc, per lane
+AVX2_TARGET static inline __m256i Run(__m256i seeds, __m256i opp, const Direction& dir) {
+    __m256i run = _mm256_and_si256(Shift(seeds, dir), opp);
+    for (int i = 0; i < 5; ++i) run = _mm256_or_si256(run, _mm256_and_si256(Shift(run, dir), opp));
+    return run;
+}
+
+AVX2_TARGET static inline __m256i MaskedOpponent(__m256i opp, const Direction& dir) {
+    return dir.vertical ? opp : _mm256_and_si256(opp, _mm256_set1_epi64x((long long)INNER_COLS));
+}
+
+AVX2_TARGET static inline __m256i LegalMoves4(__m256i own, __m256i opp) {
+    __m256i moves = _mm256_setzero_si256();
+    for (const Direction& dir : DIRECTIONS)
+        moves = _mm256_or_si256(moves, Shift(Run(own, MaskedOpponent(opp, dir), dir), dir));
+    return _mm256_andnot_si256(_mm256_or_si256(own, opp), moves);
+}
+
+// Bit count of each 64-bit lane: nibble lookup, then a byte sum per lane
+AVX2_TARGET static inline __m256i PopCount4(__m256i b) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(b, nibble));
+    __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi64(b, 4), nibble));
+    return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+}
+
+// Four children per pass: the parent's discs in every lane, one move bit per lane
+AVX2_TARGET static void GenerateChildrenAvx2(const Position& pos, const MoveList& list, Position children[]) {
+    if (list.count == 1 && list.moves[0] == PASS) {
+        children[0] = MakeMove(pos, PASS);
+        return;
+    }
+
+    int side = pos.sideToMove;
+    __m256i own = _mm256_set1_epi64x((long long)pos.discs[side]);
+    __m256i opp = _mm256_set1_epi64x((long long)pos.discs[side ^ 1]);
+    alignas(32) uint64_t moveBits[4], newOwn[4], newOpp[4];
+
+    for (int base = 0; base < list.count; base += 4) {
+        int lanes = list.count - base < 4 ? list.count - base : 4;
+        for (int k = 0; k < 4; ++k) moveBits[k] = k < lanes ? 1ULL << list.moves[base + k] : 0;
+        __m256i move = _mm256_load_si256((const __m256i*)moveBits);
+
+        __m256i flips = _mm256_setzero_si256();
+        for (const Direction& dir : DIRECTIONS) {
+            __m256i run = Run(move, MaskedOpponent(opp, dir), dir);
+            __m256i unbounded = _mm256_cmpeq_epi64(_mm256_and_si256(Shift(run, dir), own), _mm256_setzero_si256());
+            flips = _mm256_or_si256(flips, _mm256_andnot_si256(unbounded, run));
+        }
+
+        _mm256_store_si256((__m256i*)newOwn, _mm256_or_si256(own, _mm256_or_si256(flips, move)));
+        _mm256_store_si256((__m256i*)newOpp, _mm256_andnot_si256(flips, opp));
+        for (int k = 0; k < lanes; ++k) {
+            Position& child = children[base + k];
+            child.discs[side] = newOwn[k];
+            child.discs[side ^ 1] = newOpp[k];
+            child.sideToMove = side ^ 1;
+            child.hash = ComputeHash(child);
+        }
+    }
+}
+
+// Mobility for both sides and every weight class for four positions per pass
+AVX2_TARGET static void ScoreLeavesAvx2(const Position positions[], int count, int scores[]) {
+    alignas(32) uint64_t ownBits[4], oppBits[4];
+    alignas(32) int64_t heuristic[4], anyMoves[4];
+    const EvalWeights& weights = ActiveWeights();
+
+    for (int base = 0; base < count; base += 4) {
+        int lanes = count - base < 4 ? count - base : 4;
+        for (int k = 0; k < 4; ++k) {
+            const Position& pos = positions[base + (k < lanes ? k : 0)];
+            ownBits[k] = pos.discs[pos.sideToMove];
+            oppBits[k] = pos.discs[pos.sideToMove ^ 1];
+        }
+        __m256i own = _mm256_load_si256((const __m256i*)ownBits);
+        __m256i opp = _mm256_load_si256((const __m256i*)oppBits);
+
+        __m256i ownMoves = LegalMoves4(own, opp);
+        __m256i oppMoves = LegalMoves4(opp, own);
+        __m256i mobility = _mm256_sub_epi64(PopCount4(ownMoves), PopCount4(oppMoves));
+        __m256i score = _mm256_mul_epi32(mobility, _mm256_set1_epi64x(weights.mobility));
+        for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) {
+            __m256i mask = _mm256_set1_epi64x((long long)WEIGHT_CLASSES[i].mask);
+            __m256i diff = _mm256_sub_epi64(PopCount4(_mm256_and_si256(own, mask)),
+                                            PopCount4(_mm256_and_si256(opp, mask)));
+            score = _mm256_add_epi64(score, _mm256_mul_epi32(diff, _mm256_set1_epi64x(weights.classWeights[i])));
+        }
+
+        _mm256_store_si256((__m256i*)heuristic, score);
+        _mm256_store_si256((__m256i*)anyMoves, _mm256_or_si256(ownMoves, oppMoves));
+        for (int k = 0; k < lanes; ++k)
+            scores[base + k] = anyMoves[k] ? (int)heuristic[k] : FinalScore(positions[base + k]);
+    }
+}
+
+#endif
+
+void GenerateChildren(const Position& pos, const MoveList& list, Position children[]) {
+#ifdef OTHELLO_HAS_AVX2_KERNEL
+    if (activeKernel == BATCH_AVX2) return GenerateChildrenAvx2(pos, list, children);
+#endif
+    GenerateChildrenScalar(pos, list, children);
+}
+
+void ScoreLeaves(const Position positions[], int count, int scores[]) {
+#ifdef OTHELLO_HAS_AVX2_KERNEL
+    if (activeKernel == BATCH_AVX2) return ScoreLeavesAvx2(positions, count, scores);
+#endif
+    ScoreLeavesScalar(positions, count, scores);
+}
+
+} // namespace othello
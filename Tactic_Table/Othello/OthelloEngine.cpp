@@ -0,0 +1,541 @@
+#include "OthelloEngine.h"
+#include "PositionCache.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+namespace othello {
+
+// WEIGHT_CLASSES laid out per square, for ordering moves at the root
+static const int WEIGHT[NUM_SQUARES] = {
+    100, -20, 10,  5,  5, 10, -20, 100,
+    -20, -50, -2, -2, -2, -2, -50, -20,
+     10,  -2,  0,  0,  0,  0,  -2,  10,
+      5,  -2,  0,  0,  0,  0,  -2,   5,
+      5,  -2,  0,  0,  0,  0,  -2,   5,
+     10,  -2,  0,  0,  0,  0,  -2,  10,
+    -20, -50, -2, -2, -2, -2, -50, -20,
+    100, -20, 10,  5,  5, 10, -20, 100,
+};
+
+static const uint64_t NOT_COL_A = 0xFEFEFEFEFEFEFEFEULL;   // Clears column 0 after a shift right along the row
+static const uint64_t NOT_COL_H = 0x7F7F7F7F7F7F7F7FULL;   // Clears column 7 after a shift left along the row
+
+// One step in each of the 8 directions; edge masks stop discs wrapping to the next row
+static inline uint64_t Step(uint64_t b, int dir) {
+    switch (dir) {
+        case 0: return (b << 1) & NOT_COL_A;    // East
+        case 1: return (b >> 1) & NOT_COL_H;    // West
+        case 2: return b << 8;                  // South
+        case 3: return b >> 8;                  // North
+        case 4: return (b << 9) & NOT_COL_A;    // South-east
+        case 5: return (b << 7) & NOT_COL_H;    // South-west
+        case 6: return (b >> 7) & NOT_COL_A;    // North-east
+        default: return (b >> 9) & NOT_COL_H;   // North-west
+    }
+}
+
+static inline int PopCount(uint64_t bits) { return __builtin_popcountll(bits); }
+static inline int LowestBit(uint64_t bits) { return __builtin_ctzll(bits); }
+
+static inline double NowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+Position StartPosition() {
+    Position pos;
+    pos.discs[WHITE_SIDE] = (1ULL << SquareOf(3, 3)) | (1ULL << SquareOf(4, 4));
+    pos.discs[BLACK_SIDE] = (1ULL << SquareOf(3, 4)) | (1ULL << SquareOf(4, 3));
+    pos.sideToMove = BLACK_SIDE;
+    pos.hash = ComputeHash(pos);
+    return pos;
+}
+
+// A move changes many discs at once, so the key is a fresh mix of both masks rather
+// than an incrementally updated Zobrist key
+uint64_t ComputeHash(const Position& pos) {
+    auto mix = [](uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    };
+    uint64_t hash = mix(pos.discs[BLACK_SIDE] + 0x9E3779B97F4A7C15ULL) ^ mix(pos.discs[WHITE_SIDE] ^ 0xD1B54A32D192ED03ULL) * 3;
+    return pos.sideToMove == WHITE_SIDE ? ~hash : hash;
+}
+
+bool FromString(const std::string& text, Position& pos) {
+    if (text.size() != 2 + NUM_SQUARES || text[1] != ':') return false;
+    Position result;
+    if (text[0] == 'b') result.sideToMove = BLACK_SIDE;
+    else if (text[0] == 'w') result.sideToMove = WHITE_SIDE;
+    else return false;
+
+    for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+        uint64_t bit = 1ULL << sq;
+        switch (text[2 + sq]) {
+            case 'B': result.discs[BLACK_SIDE] |= bit; break;
+            case 'W': result.discs[WHITE_SIDE] |= bit; break;
+            case '.': break;
+            default: return false;
+        }
+    }
+    result.hash = ComputeHash(result);
+    pos = result;
+    return true;
+}
+
+std::string ToString(const Position& pos) {
+    std::string text = pos.sideToMove == BLACK_SIDE ? "b:" : "w:";
+    for (int sq = 0; sq < NUM_SQUARES; ++sq) {
+        uint64_t bit = 1ULL << sq;
+        text += (pos.discs[BLACK_SIDE] & bit) ? 'B' : (pos.discs[WHITE_SIDE] & bit) ? 'W' : '.';
+    }
+    return text;
+}
+
+std::string MoveToString(int move) {
+    if (move == PASS) return "pass";
+    std::string text;
+    text += (char)('a' + ColOf(move));
+    text += (char)('1' + RowOf(move));
+    return text;
+}
+
+bool ParseMove(const Position& pos, const std::string& text, int& move) {
+    MoveList list;
+    GenerateMoves(pos, list);
+    for (int i = 0; i < list.count; ++i) {
+        if (MoveToString(list.moves[i]) == text) {
+            move = list.moves[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Runs of opponent discs are grown from our discs one step at a time in all eight
+// directions at once; an empty square just past a run is a move
+uint64_t LegalMoves(uint64_t own, uint64_t opponent) {
+    uint64_t empty = ~(own | opponent);
+    uint64_t moves = 0;
+    for (int dir = 0; dir < 8; ++dir) {
+        uint64_t run = Step(own, dir) & opponent;
+        for (int i = 0; i < 5; ++i) run |= Step(run, dir) & opponent;
+        moves |= Step(run, dir) & empty;
+    }
+    return moves;
+}
+
+uint64_t Flips(uint64_t own, uint64_t opponent, int sq) {
+    uint64_t flips = 0;
+    for (int dir = 0; dir < 8; ++dir) {
+        uint64_t run = 0;
+        uint64_t cur = Step(1ULL << sq, dir);
+        while (cur & opponent) {
+            run |= cur;
+            cur = Step(cur, dir);
+        }
+        if (cur & own) flips |= run;
+    }
+    return flips;
+}
+
+void GenerateMoves(const Position& pos, MoveList& list) {
+    int side = pos.sideToMove;
+    list.count = 0;
+    for (uint64_t moves = LegalMoves(pos.discs[side], pos.discs[side ^ 1]); moves; moves &= moves - 1)
+        list.moves[list.count++] = LowestBit(moves);
+    // No placement: pass if the opponent can still play, otherwise the game is over
+    if (list.count == 0 && LegalMoves(pos.discs[side ^ 1], pos.discs[side]))
+        list.moves[list.count++] = PASS;
+}
+
+bool IsGameOver(const Position& pos) {
+    return !LegalMoves(pos.discs[0], pos.discs[1]) && !LegalMoves(pos.discs[1], pos.discs[0]);
+}
+
+Position MakeMove(const Position& pos, int move) {
+    Position next = pos;
+    int side = pos.sideToMove;
+    if (move != PASS) {
+        uint64_t flips = Flips(pos.discs[side], pos.discs[side ^ 1], move);
+        next.discs[side] |= flips | (1ULL << move);
+        next.discs[side ^ 1] &= ~flips;
+    }
+    next.sideToMove = side ^ 1;
+    next.hash = ComputeHash(next);
+    return next;
+}
+
+// Passes count as moves; a finished game is a leaf one level early
+uint64_t Perft(const Position& pos, int depth) {
+    if (depth == 0) return 1;
+    MoveList list;
+    GenerateMoves(pos, list);
+    if (depth == 1) return (uint64_t)list.count;
+
+    uint64_t total = 0;
+    for (int i = 0; i < list.count; ++i)
+        total += Perft(MakeMove(pos, list.moves[i]), depth - 1);
+    return total;
+}
+
+const WeightClass WEIGHT_CLASSES[NUM_WEIGHT_CLASSES] = {
+    {0x8100000000000081ULL, 100, "corner"},     // Corners
+    {0x0042000000004200ULL, -50, "x_square"},   // X-squares, diagonal to a corner
+    {0x4281000000008142ULL, -20, "c_square"},   // C-squares, on the edge beside a corner
+    {0x2400810000810024ULL, 10, "edge_a"},      // Edge squares two away from a corner
+    {0x1800008181000018ULL, 5, "edge_b"},       // Middle of each edge
+    {0x003C424242423C00ULL, -2, "inner_ring"},  // Ring just inside the edge
+};
+
+EvalWeights DefaultWeights() {
+    EvalWeights weights;
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) weights.classWeights[i] = WEIGHT_CLASSES[i].weight;
+    weights.mobility = MOBILITY_WEIGHT;
+    return weights;
+}
+
+static EvalWeights activeWeights = DefaultWeights();
+
+const EvalWeights& ActiveWeights() { return activeWeights; }
+
+void SetWeights(const EvalWeights& weights) {
+    auto clamp = [](int w) { return std::max(-MAX_EVAL_WEIGHT, std::min(MAX_EVAL_WEIGHT, w)); };
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) activeWeights.classWeights[i] = clamp(weights.classWeights[i]);
+    activeWeights.mobility = clamp(weights.mobility);
+}
+
+bool LoadWeights(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) return false;
+    EvalWeights weights = activeWeights;
+    int found = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string name;
+        int value;
+        if (!(fields >> name) || name[0] == '#') continue;
+        if (!(fields >> value)) return false;
+        if (name == "mobility") weights.mobility = value;
+        else {
+            int i = 0;
+            while (i < NUM_WEIGHT_CLASSES && name != WEIGHT_CLASSES[i].name) ++i;
+            if (i == NUM_WEIGHT_CLASSES) return false;
+            weights.classWeights[i] = value;
+        }
+        found++;
+    }
+    if (found == 0) return false;
+    SetWeights(weights);
+    return true;
+}
+
+bool SaveWeights(const std::string& path, const EvalWeights& weights) {
+    std::ofstream file(path);
+    if (!file) return false;
+    file << "# Othello evaluation weights (score per disc in each class, per move of mobility)\n";
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) file << WEIGHT_CLASSES[i].name << " " << weights.classWeights[i] << "\n";
+    file << "mobility " << weights.mobility << "\n";
+    return (bool)file;
+}
+
+int FinalScore(const Position& pos) {
+    int margin = PopCount(pos.discs[pos.sideToMove]) - PopCount(pos.discs[pos.sideToMove ^ 1]);
+    if (margin > 0) return SCORE_WIN + margin;
+    if (margin < 0) return -SCORE_WIN + margin;
+    return 0;
+}
+
+static int Heuristic(uint64_t own, uint64_t opp, uint64_t ownMoves, uint64_t oppMoves) {
+    int score = activeWeights.mobility * (PopCount(ownMoves) - PopCount(oppMoves));
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) {
+        uint64_t mask = WEIGHT_CLASSES[i].mask;
+        score += activeWeights.classWeights[i] * (PopCount(own & mask) - PopCount(opp & mask));
+    }
+    return score;
+}
+
+int Evaluate(const Position& pos) {
+    uint64_t own = pos.discs[pos.sideToMove], opp = pos.discs[pos.sideToMove ^ 1];
+    return Heuristic(own, opp, LegalMoves(own, opp), LegalMoves(opp, own));
+}
+
+int ScoreLeaf(const Position& pos) {
+    uint64_t own = pos.discs[pos.sideToMove], opp = pos.discs[pos.sideToMove ^ 1];
+    uint64_t ownMoves = LegalMoves(own, opp), oppMoves = LegalMoves(opp, own);
+    if (!ownMoves && !oppMoves) return FinalScore(pos);
+    return Heuristic(own, opp, ownMoves, oppMoves);
+}
+
+// --- Search ---
+
+enum TTFlag : uint8_t { TT_EXACT, TT_LOWER, TT_UPPER };
+
+Searcher::Searcher(int tableSizeMB) {
+    size_t entries = 1;
+    while (entries * 2 * sizeof(TTEntry) <= (size_t)tableSizeMB * 1024 * 1024) entries *= 2;
+    table.resize(entries);
+    tableMask = entries - 1;
+}
+
+void Searcher::ClearTable() {
+    std::fill(table.begin(), table.end(), TTEntry());
+}
+
+// --- Persistent cache ---
+
+// Only nodes this far from the horizon are worth a slot; shallower ones are quicker to
+// search again than the deep ones they would push out
+static const int CACHE_MIN_DEPTH = 6;
+
+static PositionCache* positionCache = nullptr;
+
+void UsePositionCache(PositionCache* cache) { positionCache = cache; }
+
+static uint64_t WeightsDigest(const EvalWeights& weights) {
+    uint64_t digest = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i) digest = (digest ^ (uint32_t)weights.classWeights[i]) * 0x100000001B3ULL;
+    return (digest ^ (uint32_t)weights.mobility) * 0x100000001B3ULL;
+}
+
+bool Searcher::ShouldStop() {
+    if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return true;
+    if (nodeLimit && nodes >= nodeLimit) return true;
+    if (deadlineMs > 0 && NowMs() >= deadlineMs) return true;
+    return false;
+}
+
+// Order moves in place: hash move first, then by square weight so corners come early
+static void OrderMoves(MoveList& list, int hashMove) {
+    int first = 0;
+    for (int i = 0; i < list.count; ++i) {
+        if (list.moves[i] == hashMove) {
+            std::swap(list.moves[0], list.moves[i]);
+            first = 1;
+            break;
+        }
+    }
+    std::stable_sort(list.moves + first, list.moves + list.count, [](int a, int b) {
+        return (a == PASS ? -1000 : WEIGHT[a]) > (b == PASS ? -1000 : WEIGHT[b]);
+    });
+}
+
+int Searcher::AlphaBeta(const Position& pos, int depth, int ply, int alpha, int beta) {
+    if ((++nodes & 1023) == 0 && ShouldStop()) aborted = true;
+    if (aborted) return 0;
+    if (depth <= 0) return ScoreLeaf(pos);
+
+    MoveList list;
+    GenerateMoves(pos, list);
+    if (list.count == 0) return FinalScore(pos);
+
+    TTEntry& entry = table[pos.hash & tableMask];
+    int hashMove = -1;
+    if (entry.key == pos.hash) {
+        hashMove = entry.move;
+        if (entry.depth >= depth) {
+            int ttScore = entry.score;
+            if (entry.flag == TT_EXACT) return ttScore;
+            if (entry.flag == TT_LOWER && ttScore >= beta) return ttScore;
+            if (entry.flag == TT_UPPER && ttScore <= alpha) return ttScore;
+        }
+    }
+
+    // A deep node may have been searched in an earlier game or session. Its score is only
+    // used once the iteration has reached the trusted depth: cutting off an earlier one
+    // would leave the table without the move ordering the later ones rely on.
+    CachedPosition cached;
+    if (cache && depth >= CACHE_MIN_DEPTH && cache->Probe(pos.hash ^ cacheSalt, cached)) {
+        if (hashMove < 0) hashMove = cached.move;
+        if (cached.depth >= depth + cacheSlack) {
+            if (cached.flag == TT_EXACT) return cached.score;
+            if (cached.flag == TT_LOWER && cached.score >= beta) return cached.score;
+            if (cached.flag == TT_UPPER && cached.score <= alpha) return cached.score;
+        }
+    }
+
+    Position children[MAX_MOVES];
+    int childScores[MAX_MOVES];
+    GenerateChildren(pos, list, children);
+    ScoreLeaves(children, list.count, childScores);
+
+    int originalAlpha = alpha;
+    int bestScore = -SCORE_WIN - NUM_SQUARES - 1;
+    int bestIndex = 0;
+
+    // Frontier node: every child is a leaf and the batch already scored them all
+    if (depth == 1) {
+        nodes += list.count;
+        for (int i = 0; i < list.count; ++i) {
+            if (-childScores[i] > bestScore) {
+                bestScore = -childScores[i];
+                bestIndex = i;
+            }
+        }
+    } else {
+        // Hash move first, then the children worst for the opponent
+        int order[MAX_MOVES];
+        for (int i = 0; i < list.count; ++i) order[i] = i;
+        std::stable_sort(order, order + list.count, [&](int a, int b) {
+            if ((list.moves[a] == hashMove) != (list.moves[b] == hashMove)) return list.moves[a] == hashMove;
+            return childScores[a] < childScores[b];
+        });
+
+        for (int i = 0; i < list.count; ++i) {
+            int index = order[i];
+            int score = -AlphaBeta(children[index], depth - 1, ply + 1, -beta, -alpha);
+            if (aborted) return 0;
+            if (score > bestScore) {
+                bestScore = score;
+                bestIndex = index;
+            }
+            if (score > alpha) alpha = score;
+            if (alpha >= beta) break;
+        }
+    }
+
+    entry.key = pos.hash;
+    entry.score = (int16_t)bestScore;
+    entry.depth = (int8_t)std::min(depth, 127);
+    entry.flag = bestScore <= originalAlpha ? TT_UPPER : (bestScore >= beta ? TT_LOWER : TT_EXACT);
+    entry.move = (uint8_t)list.moves[bestIndex];
+    if (cache && depth >= CACHE_MIN_DEPTH) {
+        cached.score = bestScore;
+        cached.depth = depth;
+        cached.flag = entry.flag;
+        cached.move = entry.move;
+        cache->Store(pos.hash ^ cacheSalt, cached);
+    }
+    return bestScore;
+}
+
+void Searcher::ExtractPV(Position pos, int depth, std::vector<int>& pv) {
+    pv.clear();
+    for (int i = 0; i < depth; ++i) {
+        const TTEntry& entry = table[pos.hash & tableMask];
+        if (entry.key != pos.hash) break;
+        MoveList list;
+        GenerateMoves(pos, list);
+        bool found = false;
+        for (int m = 0; m < list.count && !found; ++m) found = list.moves[m] == entry.move;
+        if (!found) break;
+        pv.push_back(entry.move);
+        pos = MakeMove(pos, entry.move);
+    }
+}
+
+SearchResult Searcher::Search(const Position& pos, const SearchLimits& limits) {
+    SearchResult result;
+    startMs = NowMs();
+    deadlineMs = limits.maxTimeMs > 0 ? startMs + limits.maxTimeMs : 0;
+    nodeLimit = limits.maxNodes;
+    stopFlag = limits.stop;
+    nodes = 0;
+    aborted = false;
+    cache = positionCache;
+    cacheSalt = cache ? WeightsDigest(activeWeights) : 0;
+
+    MoveList rootMoves;
+    GenerateMoves(pos, rootMoves);
+    if (rootMoves.count == 0) {
+        result.score = FinalScore(pos);
+        return result;
+    }
+    result.hasMove = true;
+    result.bestMove = rootMoves.moves[0];
+
+    // Searched this deep before: play that move without searching again. A time limit
+    // leaves maxDepth out of reach, so the cache is trusted from cacheDepth on.
+    int trustedDepth = std::min({limits.maxDepth, limits.cacheDepth, PopCount(pos.Empty()) + 2});
+    CachedPosition cached;
+    if (cache && !limits.allMoves && cache->Probe(pos.hash ^ cacheSalt, cached) && cached.flag == TT_EXACT
+        && cached.depth >= trustedDepth
+        && std::find(rootMoves.moves, rootMoves.moves + rootMoves.count, cached.move) != rootMoves.moves + rootMoves.count) {
+        result.bestMove = cached.move;
+        result.score = cached.score;
+        result.depth = cached.depth;
+        result.pv.push_back(cached.move);
+        result.elapsedMs = NowMs() - startMs;
+        if (limits.onIteration) limits.onIteration(result);
+        return result;
+    }
+
+    for (int depth = 1; depth <= limits.maxDepth; ++depth) {
+        cacheSlack = std::max(trustedDepth - depth, 0);
+        // Previous iteration's best move goes first; when analysing, the rest follow by
+        // their previous scores
+        OrderMoves(rootMoves, result.bestMove);
+        if (limits.allMoves && !result.moveScores.empty()) {
+            for (int i = 0; i < (int)result.moveScores.size(); ++i) rootMoves.moves[i] = result.moveScores[i].move;
+        }
+
+        int alpha = -SCORE_WIN - NUM_SQUARES - 1, beta = SCORE_WIN + NUM_SQUARES + 1;
+        int bestScore = alpha;
+        int bestIndex = 0;
+        int scores[MAX_MOVES];
+        for (int i = 0; i < rootMoves.count; ++i) {
+            // An analysis keeps the full window open, so every move gets its exact score
+            int score = -AlphaBeta(MakeMove(pos, rootMoves.moves[i]), depth - 1, 1, -beta, -alpha);
+            if (aborted) break;
+            scores[i] = score;
+            if (score > bestScore) {
+                bestScore = score;
+                bestIndex = i;
+            }
+            if (score > alpha && !limits.allMoves) alpha = score;
+        }
+        if (aborted) break;
+
+        if (limits.allMoves) {
+            result.moveScores.clear();
+            for (int i = 0; i < rootMoves.count; ++i) result.moveScores.push_back({rootMoves.moves[i], scores[i]});
+            std::stable_sort(result.moveScores.begin(), result.moveScores.end(),
+                             [](const MoveScore& a, const MoveScore& b) { return a.score > b.score; });
+        }
+        result.bestMove = rootMoves.moves[bestIndex];
+        result.score = bestScore;
+        result.depth = depth;
+
+        TTEntry& entry = table[pos.hash & tableMask];
+        entry.key = pos.hash;
+        entry.score = (int16_t)bestScore;
+        entry.depth = (int8_t)std::min(depth, 127);
+        entry.flag = TT_EXACT;
+        entry.move = (uint8_t)result.bestMove;
+        if (cache && depth >= CACHE_MIN_DEPTH) {
+            cached.score = bestScore;
+            cached.depth = depth;
+            cached.flag = TT_EXACT;
+            cached.move = result.bestMove;
+            cache->Store(pos.hash ^ cacheSalt, cached);
+        }
+
+        if (limits.onIteration) {
+            ExtractPV(pos, depth, result.pv);
+            result.nodes = nodes;
+            result.elapsedMs = NowMs() - startMs;
+            limits.onIteration(result);
+        }
+
+        // A decided game needs no deeper search (unless the other moves still need scores),
+        // and nothing is left once every square is filled
+        if (!limits.allMoves && (bestScore > SCORE_WIN - 1000 || bestScore < -SCORE_WIN + 1000)) break;
+        if (depth >= PopCount(pos.Empty()) + 2) break;
+        if (ShouldStop()) break;
+    }
+
+    ExtractPV(pos, std::max(result.depth, 1), result.pv);
+    if (result.pv.empty() || result.pv[0] != result.bestMove) {
+        result.pv.clear();
+        result.pv.push_back(result.bestMove);
+    }
+    result.nodes = nodes;
+    result.elapsedMs = NowMs() - startMs;
+    return result;
+}
+
+} // namespace othello
@@ -0,0 +1,174 @@
+#pragma once
+
+// Othello rules engine - no raylib dependency, shared by the game and the benchmarks
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class PositionCache;
+
+namespace othello {
+
+const int BOARD_SIZE = 8;
+const int NUM_SQUARES = 64;
+const int MAX_MOVES = 64;       // Upper bound on legal moves in one position
+const int PASS = 64;            // Move value when the side to move has no disc to place
+const int SCORE_WIN = 30000;    // Won game, plus the final disc margin
+
+// Sides match the game's discs: Black moves first (named apart from raylib's colour macros)
+enum Side { BLACK_SIDE = 0, WHITE_SIDE = 1 };
+
+// Square numbering: row * 8 + col, row 0 at the top, col 0 on the left
+inline int SquareOf(int row, int col) {
+    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE) return -1;
+    return row * BOARD_SIZE + col;
+}
+inline int RowOf(int sq) { return sq / BOARD_SIZE; }
+inline int ColOf(int sq) { return sq % BOARD_SIZE; }
+
+// Compact board: one 64-bit mask of discs per side
+struct Position {
+    uint64_t discs[2] = {0, 0};     // Indexed by Side
+    int sideToMove = BLACK_SIDE;
+    uint64_t hash = 0;              // Kept in sync by MakeMove
+
+    uint64_t Occupied() const { return discs[0] | discs[1]; }
+    uint64_t Empty() const { return ~Occupied(); }
+    bool operator==(const Position& other) const {
+        return discs[0] == other.discs[0] && discs[1] == other.discs[1] && sideToMove == other.sideToMove;
+    }
+};
+
+// A move is a square index, or PASS
+struct MoveList {
+    int moves[MAX_MOVES];
+    int count = 0;
+};
+
+// Board setup and conversion
+Position StartPosition();
+uint64_t ComputeHash(const Position& pos);
+bool FromString(const std::string& text, Position& pos);   // "b:" or "w:" then 64 of 'B', 'W', '.'
+std::string ToString(const Position& pos);
+std::string MoveToString(int move);                         // "d3" (column a-h, row 1-8) or "pass"
+bool ParseMove(const Position& pos, const std::string& text, int& move);
+
+// Rules
+uint64_t LegalMoves(uint64_t own, uint64_t opponent);      // One bit per square that flips something
+uint64_t Flips(uint64_t own, uint64_t opponent, int sq);    // Discs a move on sq would turn over
+void GenerateMoves(const Position& pos, MoveList& list);   // A lone PASS when only the opponent can move
+bool IsGameOver(const Position& pos);
+Position MakeMove(const Position& pos, int move);
+uint64_t Perft(const Position& pos, int depth);
+
+// Square weights grouped by value, so evaluation is a handful of masked popcounts:
+// corners good, the squares next to them bad
+struct WeightClass {
+    uint64_t mask;
+    int weight;             // Default; the evaluation uses ActiveWeights()
+    const char* name;       // Key in a weights file
+};
+const int NUM_WEIGHT_CLASSES = 6;
+extern const WeightClass WEIGHT_CLASSES[NUM_WEIGHT_CLASSES];
+// Per legal move more than the opponent has. The original game scored the square table
+// alone; this term came with the engine, so the AI's choices differ from the original's
+// even at the same depth (othello_trainer fits it along with the square weights)
+const int MOBILITY_WEIGHT = 5;
+
+// The weights Evaluate uses: the defaults above, or a file written by othello_trainer.
+// Set them before any search starts; they are not synchronised with running searches.
+struct EvalWeights {
+    int classWeights[NUM_WEIGHT_CLASSES];
+    int mobility;
+};
+const int MAX_EVAL_WEIGHT = 200;    // Keeps every evaluation inside int16 and far below SCORE_WIN
+EvalWeights DefaultWeights();
+const EvalWeights& ActiveWeights();
+void SetWeights(const EvalWeights& weights);                // Clamped to +-MAX_EVAL_WEIGHT
+bool LoadWeights(const std::string& path);                  // "name value" lines; false keeps the current weights
+bool SaveWeights(const std::string& path, const EvalWeights& weights);
+
+// Deep search results shared by every Searcher and kept between sessions (Common/PositionCache.h).
+// Set it before any search starts; null, the default, searches without one. Entries are
+// keyed by the active weights too, so new weights never reuse old scores.
+void UsePositionCache(PositionCache* cache);
+
+// Static evaluation from the side to move's point of view
+int Evaluate(const Position& pos);
+int FinalScore(const Position& pos);    // Won, lost or drawn game, from the side to move
+int ScoreLeaf(const Position& pos);     // FinalScore once the game is over, otherwise Evaluate
+
+// Batched kernels for search: all children of a node, and leaf scores for many
+// positions at once. With AVX2 they handle four positions per 256-bit register;
+// the scalar kernel gives identical results on any CPU.
+enum BatchKernel { BATCH_SCALAR, BATCH_AVX2 };
+BatchKernel ActiveBatchKernel();                // Picked from the CPU at startup
+bool SetBatchKernel(BatchKernel kernel);        // False if this CPU cannot run it
+void GenerateChildren(const Position& pos, const MoveList& list, Position children[]);
+void ScoreLeaves(const Position positions[], int count, int scores[]);
+
+struct SearchResult;
+
+struct SearchLimits {
+    int maxDepth = 64;
+    bool allMoves = false;                      // Exact score for every root move (analysis), not just the best
+    uint64_t maxNodes = 0;                      // 0 = unlimited
+    double maxTimeMs = 0;                       // 0 = unlimited
+    int cacheDepth = 10;                        // Cached results this deep are reused without searching
+    const std::atomic<bool>* stop = nullptr;    // Checked between nodes
+    std::function<void(const SearchResult&)> onIteration;  // Called after each completed depth
+};
+
+struct MoveScore {
+    int move;
+    int score;
+};
+
+struct SearchResult {
+    bool hasMove = false;
+    int bestMove = PASS;
+    int score = 0;
+    int depth = 0;                  // Last fully completed iteration
+    uint64_t nodes = 0;
+    double elapsedMs = 0;
+    std::vector<int> pv;
+    std::vector<MoveScore> moveScores;      // With allMoves: every root move, best first
+};
+
+// Iterative-deepening alpha-beta search with a transposition table
+class Searcher {
+    private:
+        struct TTEntry {
+            uint64_t key = 0;
+            int16_t score = 0;
+            int8_t depth = -1;
+            uint8_t flag = 0;
+            uint8_t move = PASS;
+        };
+
+        std::vector<TTEntry> table;
+        uint64_t tableMask = 0;
+        uint64_t nodes = 0;
+        uint64_t nodeLimit = 0;
+        double deadlineMs = 0;
+        const std::atomic<bool>* stopFlag = nullptr;
+        bool aborted = false;
+        double startMs = 0;
+        PositionCache* cache = nullptr;     // Picked up from UsePositionCache at each Search
+        uint64_t cacheSalt = 0;             // Mixed into cache keys: a digest of the weights
+        int cacheSlack = 0;                 // Plies the current iteration is short of the trusted depth
+
+        int AlphaBeta(const Position& pos, int depth, int ply, int alpha, int beta);
+        bool ShouldStop();
+        void ExtractPV(Position pos, int depth, std::vector<int>& pv);
+
+    public:
+        explicit Searcher(int tableSizeMB = 16);
+
+        SearchResult Search(const Position& pos, const SearchLimits& limits);
+        void ClearTable();
+};
+
+} // namespace othello
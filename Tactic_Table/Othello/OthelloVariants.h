@@ -0,0 +1,483 @@
+#pragma once
+// Othello on 6x6, 10x10 and 16x16 boards - no raylib dependency
+//
+// Each size gets its own bitboard type and a move-generation kernel with every shift
+// and edge mask fixed at compile time: 6x6 fits one uint64_t, 10x10 an unsigned
+// __int128 and 16x16 the four-word Bits256. BoardEngine<N> is the single interface
+// the game uses; BoardEngine<8> forwards to the hand-tuned 8x8 engine, so the standard
+// board keeps its batched search and nothing here sits on its hot path.
+#include "OthelloEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+namespace othello {
+
+// 256 squares in four words, square s in bit s % 64 of word s / 64
+struct Bits256 {
+    uint64_t w[4] = {0, 0, 0, 0};
+
+    constexpr Bits256() {}
+    constexpr explicit Bits256(uint64_t low) : w{low, 0, 0, 0} {}
+
+    constexpr Bits256 operator&(const Bits256& o) const { Bits256 r; for (int i = 0; i < 4; ++i) r.w[i] = w[i] & o.w[i]; return r; }
+    constexpr Bits256 operator|(const Bits256& o) const { Bits256 r; for (int i = 0; i < 4; ++i) r.w[i] = w[i] | o.w[i]; return r; }
+    constexpr Bits256 operator~() const { Bits256 r; for (int i = 0; i < 4; ++i) r.w[i] = ~w[i]; return r; }
+    Bits256& operator&=(const Bits256& o) { return *this = *this & o; }
+    Bits256& operator|=(const Bits256& o) { return *this = *this | o; }
+    constexpr bool operator==(const Bits256& o) const { return w[0] == o.w[0] && w[1] == o.w[1] && w[2] == o.w[2] && w[3] == o.w[3]; }
+    constexpr bool operator!=(const Bits256& o) const { return !(*this == o); }
+
+    // Towards higher squares
+    constexpr Bits256 operator<<(int n) const {
+        Bits256 r;
+        int words = n >> 6, bits = n & 63;
+        for (int i = 3; i >= words; --i) {
+            uint64_t hi = w[i - words];
+            uint64_t lo = i - words - 1 >= 0 ? w[i - words - 1] : 0;
+            r.w[i] = bits ? (hi << bits) | (lo >> (64 - bits)) : hi;
+        }
+        return r;
+    }
+    // Towards lower squares
+    constexpr Bits256 operator>>(int n) const {
+        Bits256 r;
+        int words = n >> 6, bits = n & 63;
+        for (int i = 0; i + words < 4; ++i) {
+            uint64_t lo = w[i + words];
+            uint64_t hi = i + words + 1 < 4 ? w[i + words + 1] : 0;
+            r.w[i] = bits ? (lo >> bits) | (hi << (64 - bits)) : lo;
+        }
+        return r;
+    }
+};
+
+// The same small vocabulary over every board type
+inline bool BitAny(uint64_t b) { return b != 0; }
+inline bool BitAny(unsigned __int128 b) { return b != 0; }
+inline bool BitAny(const Bits256& b) { return (b.w[0] | b.w[1] | b.w[2] | b.w[3]) != 0; }
+
+inline int BitCount(uint64_t b) { return __builtin_popcountll(b); }
+inline int BitCount(unsigned __int128 b) { return __builtin_popcountll((uint64_t)b) + __builtin_popcountll((uint64_t)(b >> 64)); }
+inline int BitCount(const Bits256& b) { return BitCount(b.w[0]) + BitCount(b.w[1]) + BitCount(b.w[2]) + BitCount(b.w[3]); }
+
+// Index of the lowest set bit; b must not be empty
+inline int LowestBit(uint64_t b) { return __builtin_ctzll(b); }
+inline int LowestBit(unsigned __int128 b) {
+    return (uint64_t)b ? __builtin_ctzll((uint64_t)b) : 64 + __builtin_ctzll((uint64_t)(b >> 64));
+}
+inline int LowestBit(const Bits256& b) {
+    int i = 0;
+    while (!b.w[i]) ++i;
+    return i * 64 + __builtin_ctzll(b.w[i]);
+}
+
+inline void ClearLowestBit(uint64_t& b) { b &= b - 1; }
+inline void ClearLowestBit(unsigned __int128& b) { b &= b - 1; }
+inline void ClearLowestBit(Bits256& b) {
+    int i = 0;
+    while (!b.w[i]) ++i;
+    b.w[i] &= b.w[i] - 1;
+}
+
+template <class Bits, class Visit>
+void ForEachBit(Bits b, Visit visit) {
+    for (; BitAny(b); ClearLowestBit(b)) visit(LowestBit(b));
+}
+
+inline uint64_t MixBits(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+inline uint64_t HashBits(uint64_t b) { return MixBits(b + 0x9E3779B97F4A7C15ULL); }
+inline uint64_t HashBits(unsigned __int128 b) { return MixBits((uint64_t)b + 0x9E3779B97F4A7C15ULL) ^ MixBits((uint64_t)(b >> 64) ^ 0xD1B54A32D192ED03ULL); }
+inline uint64_t HashBits(const Bits256& b) {
+    uint64_t hash = 0;
+    for (int i = 0; i < 4; ++i) hash = MixBits(hash ^ b.w[i] ^ (0x9E3779B97F4A7C15ULL * (i + 1)));
+    return hash;
+}
+
+// Smallest type holding N * N squares
+template <int N>
+using BoardBits = typename std::conditional<N * N <= 64, uint64_t,
+                  typename std::conditional<N * N <= 128, unsigned __int128, Bits256>::type>::type;
+
+// Square weights for any size, following the 8x8 table: corners good, the squares
+// next to them bad, edges mildly good and the ring inside the edge mildly bad
+constexpr int SquareWeight(int size, int row, int col) {
+    bool rowEdge = row == 0 || row == size - 1, colEdge = col == 0 || col == size - 1;
+    bool rowRing = row == 1 || row == size - 2, colRing = col == 1 || col == size - 2;
+    if (rowEdge && colEdge) return 100;
+    if (rowRing && colRing) return -50;
+    if (rowEdge || colEdge) {
+        int along = rowEdge ? col : row;
+        if (along == 1 || along == size - 2) return -20;
+        if (along == 2 || along == size - 3) return 10;
+        return 5;
+    }
+    if (rowRing || colRing) return -2;
+    return 0;
+}
+
+// Squares of an N x N board for which keep(row, col) holds
+template <int N, class Keep>
+constexpr BoardBits<N> SquareMask(Keep keep) {
+    BoardBits<N> mask = BoardBits<N>(0);
+    for (int sq = 0; sq < N * N; ++sq)
+        if (keep(sq / N, sq % N)) mask = mask | (BoardBits<N>(1) << sq);
+    return mask;
+}
+
+// Move generation with every shift and mask a compile-time constant for this size
+template <int N>
+class VariantKernel {
+    static_assert(N % 2 == 0 && N >= 4 && N <= 16, "Othello boards are even-sized, 4x4 to 16x16");
+
+    public:
+        typedef BoardBits<N> Bits;
+        static const int SQUARES = N * N;
+
+        static constexpr Bits ALL = SquareMask<N>([](int, int) { return true; });
+        static constexpr Bits NOT_FIRST_COL = SquareMask<N>([](int, int col) { return col != 0; });
+        static constexpr Bits NOT_LAST_COL = SquareMask<N>([](int, int col) { return col != N - 1; });
+
+        // One step in direction Dir (same order as the 8x8 engine); the masks stop discs
+        // wrapping to the next row or running off the board
+        template <int Dir>
+        static Bits Shift(const Bits& b) {
+            if (Dir == 0) return (b << 1) & NOT_FIRST_COL;          // East
+            if (Dir == 1) return (b >> 1) & NOT_LAST_COL;           // West
+            if (Dir == 2) return (b << N) & ALL;                    // South
+            if (Dir == 3) return b >> N;                            // North
+            if (Dir == 4) return (b << (N + 1)) & NOT_FIRST_COL;    // South-east
+            if (Dir == 5) return (b << (N - 1)) & NOT_LAST_COL;     // South-west
+            if (Dir == 6) return (b >> (N - 1)) & NOT_FIRST_COL;    // North-east
+            return (b >> (N + 1)) & NOT_LAST_COL;                   // North-west
+        }
+
+        template <int Dir>
+        static Bits MovesToward(const Bits& own, const Bits& opp) {
+            Bits run = Shift<Dir>(own) & opp;
+            for (int i = 0; i < N - 3; ++i) run = run | (Shift<Dir>(run) & opp);
+            return Shift<Dir>(run);
+        }
+
+        static Bits LegalMoves(const Bits& own, const Bits& opp) {
+            Bits moves = MovesToward<0>(own, opp) | MovesToward<1>(own, opp) | MovesToward<2>(own, opp) |
+                         MovesToward<3>(own, opp) | MovesToward<4>(own, opp) | MovesToward<5>(own, opp) |
+                         MovesToward<6>(own, opp) | MovesToward<7>(own, opp);
+            return moves & ~(own | opp);
+        }
+
+        template <int Dir>
+        static Bits FlipsToward(const Bits& own, const Bits& opp, const Bits& move) {
+            Bits run = Bits(0);
+            Bits cur = Shift<Dir>(move);
+            while (BitAny(cur & opp)) {
+                run = run | cur;
+                cur = Shift<Dir>(cur);
+            }
+            return BitAny(cur & own) ? run : Bits(0);
+        }
+
+        static Bits Flips(const Bits& own, const Bits& opp, int sq) {
+            Bits move = Bits(1) << sq;
+            return FlipsToward<0>(own, opp, move) | FlipsToward<1>(own, opp, move) | FlipsToward<2>(own, opp, move) |
+                   FlipsToward<3>(own, opp, move) | FlipsToward<4>(own, opp, move) | FlipsToward<5>(own, opp, move) |
+                   FlipsToward<6>(own, opp, move) | FlipsToward<7>(own, opp, move);
+        }
+};
+
+template <int N>
+struct VariantPosition {
+    typedef BoardBits<N> Bits;
+    Bits discs[2] = {Bits(0), Bits(0)};     // Indexed by Side
+    int sideToMove = BLACK_SIDE;
+    uint64_t hash = 0;
+
+    Bits Occupied() const { return discs[0] | discs[1]; }
+};
+
+template <int N>
+struct VariantMoveList {
+    int moves[N * N];
+    int count = 0;
+};
+
+// Rules for an N x N board: the same API as the 8x8 engine, with PASS = N * N
+template <int N>
+class VariantRules {
+    public:
+        typedef VariantKernel<N> Kernel;
+        typedef typename Kernel::Bits Bits;
+        typedef VariantPosition<N> Position;
+        typedef VariantMoveList<N> MoveList;
+        static const int SQUARES = N * N;
+        static const int PASS = N * N;
+
+        static uint64_t ComputeHash(const Position& pos) {
+            uint64_t hash = HashBits(pos.discs[BLACK_SIDE]) ^ MixBits(HashBits(pos.discs[WHITE_SIDE]));
+            return pos.sideToMove == WHITE_SIDE ? ~hash : hash;
+        }
+
+        static Position StartPosition() {
+            Position pos;
+            int mid = N / 2;
+            pos.discs[WHITE_SIDE] = (Bits(1) << ((mid - 1) * N + mid - 1)) | (Bits(1) << (mid * N + mid));
+            pos.discs[BLACK_SIDE] = (Bits(1) << ((mid - 1) * N + mid)) | (Bits(1) << (mid * N + mid - 1));
+            pos.hash = ComputeHash(pos);
+            return pos;
+        }
+
+        static Bits LegalMoves(const Bits& own, const Bits& opp) { return Kernel::LegalMoves(own, opp); }
+        static Bits Flips(const Bits& own, const Bits& opp, int sq) { return Kernel::Flips(own, opp, sq); }
+
+        static void GenerateMoves(const Position& pos, MoveList& list) {
+            int side = pos.sideToMove;
+            list.count = 0;
+            ForEachBit(LegalMoves(pos.discs[side], pos.discs[side ^ 1]), [&](int sq) { list.moves[list.count++] = sq; });
+            if (list.count == 0 && BitAny(LegalMoves(pos.discs[side ^ 1], pos.discs[side])))
+                list.moves[list.count++] = PASS;
+        }
+
+        static bool IsGameOver(const Position& pos) {
+            return !BitAny(LegalMoves(pos.discs[0], pos.discs[1])) && !BitAny(LegalMoves(pos.discs[1], pos.discs[0]));
+        }
+
+        static Position MakeMove(const Position& pos, int move) {
+            Position next = pos;
+            int side = pos.sideToMove;
+            if (move != PASS) {
+                Bits flips = Flips(pos.discs[side], pos.discs[side ^ 1], move);
+                next.discs[side] = next.discs[side] | flips | (Bits(1) << move);
+                next.discs[side ^ 1] = next.discs[side ^ 1] & ~flips;
+            }
+            next.sideToMove = side ^ 1;
+            next.hash = ComputeHash(next);
+            return next;
+        }
+
+        static uint64_t Perft(const Position& pos, int depth) {
+            if (depth == 0) return 1;
+            MoveList list;
+            GenerateMoves(pos, list);
+            if (depth == 1) return (uint64_t)list.count;
+            uint64_t total = 0;
+            for (int i = 0; i < list.count; ++i) total += Perft(MakeMove(pos, list.moves[i]), depth - 1);
+            return total;
+        }
+
+        static int FinalScore(const Position& pos) {
+            int margin = BitCount(pos.discs[pos.sideToMove]) - BitCount(pos.discs[pos.sideToMove ^ 1]);
+            if (margin > 0) return SCORE_WIN + margin;
+            if (margin < 0) return -SCORE_WIN + margin;
+            return 0;
+        }
+
+        static Bits WeightMask(int weight) {
+            return SquareMask<N>([weight](int row, int col) { return SquareWeight(N, row, col) == weight; });
+        }
+
+        // Squares of each of the 8x8 weight classes, in WEIGHT_CLASSES order
+        static std::vector<Bits> ClassMasks() {
+            std::vector<Bits> masks;
+            for (const WeightClass& weightClass : WEIGHT_CLASSES) masks.push_back(WeightMask(weightClass.weight));
+            return masks;
+        }
+
+        // Same weight classes and mobility term as the 8x8 evaluation, always with the
+        // built-in weights: othello_trainer fits its weights to 8x8 games, where each class
+        // covers a fixed share of the board, so weights loaded with LoadWeights are not used here
+        static int Evaluate(const Position& pos) {
+            static const std::vector<Bits> CLASS_MASKS = ClassMasks();
+            const Bits& own = pos.discs[pos.sideToMove];
+            const Bits& opp = pos.discs[pos.sideToMove ^ 1];
+            int score = MOBILITY_WEIGHT * (BitCount(LegalMoves(own, opp)) - BitCount(LegalMoves(opp, own)));
+            for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i)
+                score += WEIGHT_CLASSES[i].weight * (BitCount(own & CLASS_MASKS[i]) - BitCount(opp & CLASS_MASKS[i]));
+            return score;
+        }
+};
+
+// Iterative-deepening alpha-beta with a transposition table, as othello::Searcher.
+// Kept separate on purpose: the 8x8 searcher is built around its batched AVX2 kernels,
+// the position cache and the trained weights, none of which the other sizes use, and
+// this plain version is what every non-8x8 board gets (see VariantRules::Evaluate).
+template <int N>
+class VariantSearcher {
+    private:
+        typedef VariantRules<N> Rules;
+        typedef typename Rules::Position Position;
+        typedef typename Rules::MoveList MoveList;
+        enum TTFlag : uint8_t { TT_EXACT, TT_LOWER, TT_UPPER };
+
+        struct TTEntry {
+            uint64_t key = 0;
+            int16_t score = 0;
+            int8_t depth = -1;
+            uint8_t flag = 0;
+            int16_t move = -1;
+        };
+
+        std::vector<TTEntry> table;
+        uint64_t tableMask = 0;
+        uint64_t nodes = 0;
+        uint64_t nodeLimit = 0;
+        double deadlineMs = 0;
+        const std::atomic<bool>* stopFlag = nullptr;
+        bool aborted = false;
+
+        static double NowMs() {
+            using namespace std::chrono;
+            return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+        }
+
+        bool ShouldStop() {
+            if (stopFlag && stopFlag->load(std::memory_order_relaxed)) return true;
+            if (nodeLimit && nodes >= nodeLimit) return true;
+            return deadlineMs > 0 && NowMs() >= deadlineMs;
+        }
+
+        // Hash move first, then by square weight so corners come early
+        static void OrderMoves(MoveList& list, int hashMove) {
+            std::stable_sort(list.moves, list.moves + list.count, [hashMove](int a, int b) {
+                if ((a == hashMove) != (b == hashMove)) return a == hashMove;
+                int wa = a == Rules::PASS ? -1000 : SquareWeight(N, a / N, a % N);
+                int wb = b == Rules::PASS ? -1000 : SquareWeight(N, b / N, b % N);
+                return wa > wb;
+            });
+        }
+
+        int AlphaBeta(const Position& pos, int depth, int alpha, int beta) {
+            if ((++nodes & 1023) == 0 && ShouldStop()) aborted = true;
+            if (aborted) return 0;
+
+            MoveList list;
+            Rules::GenerateMoves(pos, list);
+            if (list.count == 0) return Rules::FinalScore(pos);
+            if (depth <= 0) return Rules::Evaluate(pos);
+
+            TTEntry& entry = table[pos.hash & tableMask];
+            int hashMove = -1;
+            if (entry.key == pos.hash) {
+                hashMove = entry.move;
+                if (entry.depth >= depth) {
+                    if (entry.flag == TT_EXACT) return entry.score;
+                    if (entry.flag == TT_LOWER && entry.score >= beta) return entry.score;
+                    if (entry.flag == TT_UPPER && entry.score <= alpha) return entry.score;
+                }
+            }
+            OrderMoves(list, hashMove);
+
+            int originalAlpha = alpha;
+            int bestScore = -SCORE_WIN - Rules::SQUARES - 1;
+            int bestMove = list.moves[0];
+            for (int i = 0; i < list.count; ++i) {
+                int score = -AlphaBeta(Rules::MakeMove(pos, list.moves[i]), depth - 1, -beta, -alpha);
+                if (aborted) return 0;
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestMove = list.moves[i];
+                }
+                if (score > alpha) alpha = score;
+                if (alpha >= beta) break;
+            }
+
+            entry.key = pos.hash;
+            entry.score = (int16_t)bestScore;
+            entry.depth = (int8_t)std::min(depth, 127);
+            entry.flag = bestScore <= originalAlpha ? TT_UPPER : (bestScore >= beta ? TT_LOWER : TT_EXACT);
+            entry.move = (int16_t)bestMove;
+            return bestScore;
+        }
+
+    public:
+        explicit VariantSearcher(int tableSizeMB = 16) {
+            size_t entries = 1;
+            while (entries * 2 * sizeof(TTEntry) <= (size_t)tableSizeMB * 1024 * 1024) entries *= 2;
+            table.resize(entries);
+            tableMask = entries - 1;
+        }
+
+        void ClearTable() { std::fill(table.begin(), table.end(), TTEntry()); }
+
+        SearchResult Search(const Position& pos, const SearchLimits& limits) {
+            SearchResult result;
+            double startMs = NowMs();
+            deadlineMs = limits.maxTimeMs > 0 ? startMs + limits.maxTimeMs : 0;
+            nodeLimit = limits.maxNodes;
+            stopFlag = limits.stop;
+            nodes = 0;
+            aborted = false;
+
+            MoveList rootMoves;
+            Rules::GenerateMoves(pos, rootMoves);
+            result.bestMove = Rules::PASS;
+            if (rootMoves.count == 0) {
+                result.score = Rules::FinalScore(pos);
+                return result;
+            }
+            result.hasMove = true;
+            result.bestMove = rootMoves.moves[0];
+
+            for (int depth = 1; depth <= limits.maxDepth; ++depth) {
+                OrderMoves(rootMoves, result.bestMove);
+                int alpha = -SCORE_WIN - Rules::SQUARES - 1, beta = SCORE_WIN + Rules::SQUARES + 1;
+                int bestScore = alpha, bestMove = rootMoves.moves[0];
+                for (int i = 0; i < rootMoves.count; ++i) {
+                    int score = -AlphaBeta(Rules::MakeMove(pos, rootMoves.moves[i]), depth - 1, -beta, -alpha);
+                    if (aborted) break;
+                    if (score > bestScore) {
+                        bestScore = score;
+                        bestMove = rootMoves.moves[i];
+                    }
+                    if (score > alpha) alpha = score;
+                }
+                if (aborted) break;
+
+                result.bestMove = bestMove;
+                result.score = bestScore;
+                result.depth = depth;
+                result.pv.assign(1, bestMove);
+                if (limits.onIteration) {
+                    result.nodes = nodes;
+                    result.elapsedMs = NowMs() - startMs;
+                    limits.onIteration(result);
+                }
+                if (bestScore > SCORE_WIN - 1000 || bestScore < -SCORE_WIN + 1000) break;
+                if (depth >= Rules::SQUARES - BitCount(pos.Occupied()) + 2) break;
+                if (ShouldStop()) break;
+            }
+
+            result.pv.assign(1, result.bestMove);
+            result.nodes = nodes;
+            result.elapsedMs = NowMs() - startMs;
+            return result;
+        }
+};
+
+// The interface the game is written against, one per board size
+template <int N>
+struct BoardEngine : VariantRules<N> {
+    typedef VariantSearcher<N> Searcher;
+};
+
+// The standard board: the hand-tuned 8x8 engine with its batched search
+template <>
+struct BoardEngine<8> {
+    typedef uint64_t Bits;
+    typedef othello::Position Position;
+    typedef othello::Searcher Searcher;
+    static const int SQUARES = NUM_SQUARES;
+    static const int PASS = othello::PASS;
+
+    static Position StartPosition() { return othello::StartPosition(); }
+    static Bits LegalMoves(Bits own, Bits opp) { return othello::LegalMoves(own, opp); }
+    static Bits Flips(Bits own, Bits opp, int sq) { return othello::Flips(own, opp, sq); }
+    static bool IsGameOver(const Position& pos) { return othello::IsGameOver(pos); }
+    static Position MakeMove(const Position& pos, int move) { return othello::MakeMove(pos, move); }
+};
+
+} // namespace othello
@@ -0,0 +1,776 @@
+// Include necessary libraries
+#include "raylib.h"     // For graphics and input handling
+#include "OthelloVariants.h"    // Rules and search for every board size, shared with the benchmarks
+#include "OthelloAI.h"      // Background search for the computer player and the hints overlay
+#include "ResourceCache.h"  // Sounds and fonts, loaded in the background
+#include "EngineProcess.h"  // Optional out-of-process AI
+#include "FramePacer.h"     // Redraw only when something changes
+#include "PositionCache.h"  // Deep search results kept between sessions
+#include <iostream>     // For console output
+#include <fstream>      // For file handling
+#include <ctime>        // For date/time functions
+#include <stdexcept>    // For standard exceptions
+#include <string>       // For engine protocol lines
+#include <memory>       // For the lazily created move analysis
+#include <vector>       // For the list of animating cells
+using namespace std;
+
+const int SCREEN_WIDTH = 640;   // Window width
+const int SCREEN_HEIGHT = 640;  // Window height
+const int AI_SEARCH_DEPTH = 8;          // Plies the computer looks ahead
+const double AI_SEARCH_TIME_MS = 1000;  // Cap on one computer move's thinking time
+const int HINT_MAX_DEPTH = 20;          // The hints overlay stops deepening here
+const string WEIGHTS_PATH = "resources/othello/weights.txt";   // Written by othello_trainer
+bool weightsLoaded = false;             // WEIGHTS_PATH was read at startup
+
+// Game enumerations
+enum Cell { EMPTY, Black_Disc, White_Disc };    // Possible cell states
+enum GameState { MENU, MODE_SELECTION, GAMEPLAY, SCORE_HISTORY };  // Game screens
+enum GameResult { NONE, BLACK_WINS, WHITE_WINS, DRAW }; // Game outcomes
+
+// Utility for drawing button
+static bool DrawButton(Rectangle bounds, const char* text) {
+    Vector2 mouse = GetMousePosition();
+    bool hovered = CheckCollisionPointRec(mouse, bounds);
+    DrawRectangleRec(bounds, hovered ? GRAY : LIGHTGRAY);
+    DrawText(text, bounds.x + 10, bounds.y + 10, 20, BLACK);
+    return hovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+}
+
+static bool DrawSmallButton(Rectangle bounds, const char* text, int fontSize = 20) {
+    Vector2 mouse = GetMousePosition();
+    bool hovered = CheckCollisionPointRec(mouse, bounds);
+    DrawRectangleRec(bounds, hovered ? GRAY : LIGHTGRAY);
+    DrawText(text, bounds.x + 5, bounds.y + 5, fontSize, BLACK);
+    return hovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+}
+
+// Board class - represents an N x N Othello board; the engine is picked per size at compile time
+template <int N>
+class Board {
+    private:
+        float flipProgress[N][N] = {};      // Animation progress for each cell
+        vector<int> animating;              // Squares whose flipProgress is still above zero
+    public:
+        typedef othello::BoardEngine<N> Engine;
+        typedef typename Engine::Bits Bits;
+        static const int CELL_SIZE = SCREEN_WIDTH / N;  // Size of each cell
+
+        Cell board[N][N];                       // 2D array representing the board
+        Cell currentPlayer;                     // Current player (black or white)
+        bool validMoves[N][N];                  // Track valid moves for highlighting
+        typename Engine::Position position;     // Rules state; board[][] mirrors it for drawing
+
+        // Constructor - initialize board and starting player
+        Board(){
+            currentPlayer = Black_Disc;
+            Initialize_Board();
+        }
+
+        // Calculate all valid moves for a player
+        void ComputeValidMoves(Cell player)
+        {
+            for (int row = 0; row < N; ++row) {
+                for (int col = 0; col < N; ++col) {
+                    validMoves[row][col] = IsValidMove(row, col, player);
+                }
+            }
+        }
+
+        // Check if a move is valid for a specific player
+        bool IsValidMove(int row, int col, Cell player)
+        {
+                int side = SideOf(player);
+                Bits moves = Engine::LegalMoves(position.discs[side], position.discs[side ^ 1]);
+                return othello::BitAny(moves & (Bits(1) << (row * N + col)));
+        }
+
+        // Initialize the board with starting positions
+        void Initialize_Board() {
+            position = Engine::StartPosition();
+            SyncCells();
+        }
+
+        // Copy the engine position into the drawable cell grid
+        void SyncCells() {
+            for (int row = 0; row < N; row++) {
+                for (int col = 0; col < N; col++) {
+                    Bits bit = Bits(1) << (row * N + col);
+                    if (othello::BitAny(position.discs[othello::BLACK_SIDE] & bit)) board[row][col] = Black_Disc;
+                    else if (othello::BitAny(position.discs[othello::WHITE_SIDE] & bit)) board[row][col] = White_Disc;
+                    else board[row][col] = EMPTY;
+                }
+            }
+            currentPlayer = position.sideToMove == othello::BLACK_SIDE ? Black_Disc : White_Disc;
+        }
+
+        static int SideOf(Cell player) {
+            return player == Black_Disc ? othello::BLACK_SIDE : othello::WHITE_SIDE;
+        }
+
+        // Check if coordinates are within board boundaries
+        bool Is_Within_Boundaries(int x, int y) {
+            return x >= 0 && x < N && y >= 0 && y < N;
+        }
+        // Only the cells that are still flipping
+        void UpdateAnimations() {
+            float step = FramePacer::FrameTime() * 4;
+            for (size_t i = 0; i < animating.size();) {
+                float& progress = flipProgress[animating[i] / N][animating[i] % N];
+                progress -= step;
+                if (progress > 0) {
+                    i++;
+                } else {
+                    progress = 0;
+                    animating[i] = animating.back();
+                    animating.pop_back();
+                }
+            }
+        }
+        bool IsAnimating() const { return !animating.empty(); }
+        // Check if a piece can be placed at (x,y)
+        bool CanPlace(int x, int y) {
+            return Is_Within_Boundaries(x, y) && IsValidMove(y, x, currentPlayer);
+        }
+
+        // Place a piece on the board if valid
+        void PlacePiece(int x, int y) {
+            if (!CanPlace(x, y)) return;
+            int side = position.sideToMove;
+            int sq = y * N + x;
+            Bits flips = Engine::Flips(position.discs[side], position.discs[side ^ 1], sq);
+            othello::ForEachBit(flips, [this](int flipped) {
+                float& progress = flipProgress[flipped / N][flipped % N];
+                if (progress <= 0) animating.push_back(flipped);
+                progress = 1.0f; // Start animation
+            });
+            position = Engine::MakeMove(position, sq);
+            SyncCells();
+        }
+
+        // Hand the turn over when the current player has no move
+        void Pass() {
+            position = Engine::MakeMove(position, Engine::PASS);
+            SyncCells();
+        }
+
+        // Draw the game board
+        void DrawBoard(bool showHighlights) {
+            // Color definitions
+            Color Board_Background_Color = DARKGREEN;
+            Color Grid_Line_Color = BLACK;
+            Color Black_Disc_Color = BLACK;
+            Color White_Disc_Color = WHITE;
+            Color Highlight_Color = RED; // Color for valid move highlights
+
+            ClearBackground(Board_Background_Color);
+
+            // Draw each cell
+            for (int y = 0; y < N; y++) {
+                for (int x = 0; x < N; x++) {
+                    // Draw grid lines
+                    DrawRectangleLines(x * CELL_SIZE, y * CELL_SIZE, CELL_SIZE, CELL_SIZE, Grid_Line_Color);
+
+                    // Highlights
+                    if(showHighlights){
+                        Vector2 mousePos = GetMousePosition();
+                        int hoverX = mousePos.x / CELL_SIZE;
+                        int hoverY = mousePos.y / CELL_SIZE;
+
+                        if (Is_Within_Boundaries(hoverX, hoverY)) {
+                            if (board[hoverY][hoverX] == EMPTY && IsValidMove(hoverY, hoverX, currentPlayer)) {
+                                DrawRectangle(hoverX * CELL_SIZE, hoverY * CELL_SIZE, 
+                                            CELL_SIZE, CELL_SIZE, Fade(LIGHTGRAY, 0.2f));
+                            }
+                        }
+                    }
+                    // Draw disc if present
+                    if (board[y][x] != EMPTY) {
+                        Color Disc_Color = (board[y][x] == Black_Disc) ? Black_Disc_Color : White_Disc_Color;
+                        float scale = 1.0f - flipProgress[y][x];
+                        float radius = (CELL_SIZE / 2 - 5) * scale;
+                        DrawCircle(x * CELL_SIZE + CELL_SIZE / 2, 
+                                y * CELL_SIZE + CELL_SIZE / 2, 
+                                radius, Disc_Color);
+                    }
+
+                    // Highlight valid moves for current player
+                    else if (IsValidMove(y, x, currentPlayer)) {
+                        DrawCircle(x * CELL_SIZE + CELL_SIZE / 2, y * CELL_SIZE + CELL_SIZE / 2, 7, Highlight_Color);
+                    }
+                }
+            }
+        }
+    };
+
+// Human player implementation
+template <int N>
+class Player {
+    public:
+        virtual void MakeMove(Board<N>& board, GameResult& result, bool& gameOver) = 0;
+        virtual void ShowScore(int blackCount, int whiteCount) = 0;
+        virtual void ReturnToMenu(GameState& gameState) = 0;
+        virtual bool Thinking() const { return false; }    // Still working on a move after MakeMove returned
+        virtual ~Player() {}
+    };
+ 
+template <int N>
+class HumanPlayer : public Player<N> {
+public:
+    void MakeMove(Board<N>& board, GameResult& result, bool& gameOver) override {
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            Vector2 mouse = GetMousePosition();
+            int x = mouse.x / Board<N>::CELL_SIZE;
+            int y = mouse.y / Board<N>::CELL_SIZE;
+            if (board.CanPlace(x, y)) {
+                board.PlacePiece(x, y);
+            }
+        }
+    }
+
+    void ShowScore(int blackCount, int whiteCount) override {
+        cout << "Black: " << blackCount << " | White: " << whiteCount << "\n";
+    }
+
+    void ReturnToMenu(GameState& gameState) override {
+        gameState = MENU;
+    }
+};
+
+// AI player implementation: MakeMove starts the search on a worker thread and later
+// calls play its move once it is done, so the window keeps drawing while it thinks
+template <int N>
+class AIPlayer : public Player<N> {
+    private:
+        typedef typename Board<N>::Engine Engine;
+        typename Engine::Searcher searcher;     // Keeps its transposition table between moves
+        AsyncSearch<typename Engine::Searcher, typename Engine::Position, othello::SearchLimits, othello::SearchResult> search;
+        bool searching = false;
+
+    public:
+        AIPlayer() : search(searcher) {}
+
+        void MakeMove(Board<N>& board, GameResult& result, bool& gameOver) override {
+            if (!searching) {
+                othello::SearchLimits limits;
+                limits.maxDepth = AI_SEARCH_DEPTH;
+                limits.maxTimeMs = AI_SEARCH_TIME_MS;
+                search.Start(board.position, limits);
+                searching = true;
+                return;
+            }
+            if (!search.Finished()) return;
+
+            searching = false;
+            othello::SearchResult best = search.Latest();
+            if (best.hasMove && best.bestMove != Engine::PASS) {
+                board.PlacePiece(best.bestMove % N, best.bestMove / N);
+            } else {
+                cout << "AI has no valid moves. Passing...\n";
+            }
+        }
+
+        bool Thinking() const override { return searching; }
+
+        void ShowScore(int blackCount, int whiteCount) override {
+            cout << "AI Score - Black: " << blackCount << " | White: " << whiteCount << "\n";
+        }
+
+        void ReturnToMenu(GameState& gameState) override {
+            gameState = MENU;
+        }
+};
+
+
+// AI player that runs tactic_engine in its own process (8x8 only): MakeMove sends the
+// position and returns at once, later calls pick up the bestmove line, so a slow search
+// never holds up a frame. Falls back to the in-process AI if the engine goes away.
+class EngineAIPlayer : public Player<8> {
+    private:
+        EngineProcess engine;
+        AIPlayer<8> fallback;
+        bool searching = false;
+
+    public:
+        explicit EngineAIPlayer(const string& command) {
+            if (!engine.Start(command)) cerr << "Could not start engine: " << command << "\n";
+            // The engine is a separate process, so it needs the trained weights sent to it
+            else if (weightsLoaded && engine.Send("weights " + WEIGHTS_PATH)) engine.Send("newgame");
+        }
+
+        void MakeMove(Board<8>& board, GameResult& result, bool& gameOver) override {
+            if (fallback.Thinking()) {
+                fallback.MakeMove(board, result, gameOver);
+                return;
+            }
+            if (!searching) {
+                searching = engine.Send("position " + othello::ToString(board.position)) &&
+                            engine.Send(TextFormat("go depth %d movetime %d", AI_SEARCH_DEPTH, (int)AI_SEARCH_TIME_MS));
+                if (!searching) fallback.MakeMove(board, result, gameOver);
+                return;
+            }
+
+            string line;
+            while (engine.PollLine(line)) {
+                if (line.compare(0, 9, "bestmove ") != 0) continue;
+                searching = false;
+                int move;
+                if (othello::ParseMove(board.position, line.substr(9), move) && move != othello::PASS)
+                    board.PlacePiece(othello::ColOf(move), othello::RowOf(move));
+                return;
+            }
+            if (!engine.Running()) {
+                searching = false;
+                fallback.MakeMove(board, result, gameOver);
+            }
+        }
+
+        bool Thinking() const override { return searching || fallback.Thinking(); }
+
+        void ShowScore(int blackCount, int whiteCount) override {
+            cout << "Engine Score - Black: " << blackCount << " | White: " << whiteCount << "\n";
+        }
+
+        void ReturnToMenu(GameState& gameState) override {
+            gameState = MENU;
+        }
+};
+
+// Global game state
+GameState gameState = MENU;
+string engineCommand;   // Set by --engine; empty keeps the AI in process
+
+// What the screens need from a game, whatever its board size
+class GameBase {
+    public:
+        virtual void InitPlayers(bool vsAI_mode) = 0;
+        virtual void HandleInput() = 0;
+        virtual void Draw() = 0;
+        virtual FrameActivity Activity() const = 0;    // How often this game needs redrawing
+        virtual ~GameBase() {}
+};
+
+template <int N>
+class Game : public GameBase {
+
+    private:
+        ResourceCache& resources;
+        SoundHandle placeSound;
+        SoundHandle flipSound;
+        SoundHandle gameOverSound;
+
+        void SaveScore(int blackCount, int whiteCount) {
+            try {
+                ofstream file("scores.txt", ios::app); // Append mode
+                if (!file) throw  runtime_error("Failed to open scores file");
+
+                // Get current timestamp
+                time_t now = time(nullptr);
+                if (now == -1) throw runtime_error("Failed to get time");
+                    tm* tm =  localtime(&now);
+                if (!tm) throw runtime_error("Failed to convert time");
+                
+                char timeStr[80];
+                strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", tm);
+
+                // Write score entry
+                file << "[" << timeStr << "] Black: " << blackCount 
+                        << " | White: " << whiteCount << " | Winner: ";
+                        
+                switch (result) {
+                    case BLACK_WINS: file << "Black"; break;
+                    case WHITE_WINS: file << "White"; break;
+                    case DRAW:       file << "Draw";  break;
+                    default:         file << "None";  break;
+                }
+                file << "\n";
+
+            } catch (const  exception& e) {
+                    cerr << "Score save error: " << e.what() << "\n";
+            }
+        }
+
+    public:
+        Board<N> board;                 // Game board
+        bool vsAI = false;              // Playing against AI?
+        bool gameOver = false;          // Is game over?
+        GameResult result = NONE;       //Game Result
+    
+        Player<N>* blackPlayer = nullptr;   // Player 1 (Black)
+        Player<N>* whitePlayer = nullptr;   // Player 2 or AI (White)
+
+        double aiStartTime = 0;     // Timer for AI moves
+        bool aiThinking = false;    // Is AI thinking?
+        const double aiDelay = 3.0; // Delay before AI moves (seconds)
+
+        bool showHints = false;                             // Score every legal move for the human
+        unique_ptr<othello::MoveAnalysis> analysis;         // 8x8 only; created when hints are first shown
+
+        // Hints: run the analysis on the human's turns and print each move's score in its
+        // cell, best move highlighted. Scores deepen while the human thinks.
+        void DrawHints() {
+            if constexpr (N == 8) {
+                bool humanTurn = !gameOver && !(vsAI && board.currentPlayer == White_Disc);
+                if (!showHints || !humanTurn) {
+                    if (analysis) analysis->Stop();
+                    return;
+                }
+                if (!analysis) analysis.reset(new othello::MoveAnalysis(HINT_MAX_DEPTH));
+                analysis->Update(board.position);
+
+                othello::SearchResult hints = analysis->Latest();
+                const int cell = Board<N>::CELL_SIZE;
+                for (size_t i = 0; i < hints.moveScores.size(); i++) {
+                    const othello::MoveScore& hint = hints.moveScores[i];
+                    if (hint.move == othello::PASS) continue;
+                    const char* text;
+                    if (hint.score > othello::SCORE_WIN - 1000) text = TextFormat("W+%d", hint.score - othello::SCORE_WIN);
+                    else if (hint.score < -othello::SCORE_WIN + 1000) text = TextFormat("L%d", hint.score + othello::SCORE_WIN);
+                    else text = TextFormat("%+d", hint.score);
+                    int x = othello::ColOf(hint.move) * cell + (cell - MeasureText(text, 20)) / 2;
+                    int y = othello::RowOf(hint.move) * cell + cell / 2 + 10;
+                    DrawText(text, x, y, 20, i == 0 ? GOLD : RAYWHITE);
+                }
+                if (hints.depth > 0)
+                    DrawText(TextFormat("Hints: depth %d", hints.depth), SCREEN_WIDTH - 180, SCREEN_HEIGHT - 30, 20, WHITE);
+            }
+        }
+
+        void StopHints() {
+            if (analysis) analysis->Stop();
+        }
+
+        FrameActivity Activity() const override {
+            if (board.IsAnimating()) return FRAME_ANIMATING;
+            // The AI's delay timer, the engine's reply and deepening hints all arrive without input
+            if (!gameOver && vsAI && board.currentPlayer == White_Disc) return FRAME_WAITING;
+            if (showHints && analysis && analysis->Searching()) return FRAME_WAITING;
+            return FRAME_IDLE;
+        }
+
+        // Constructor
+        Game(ResourceCache& resources) : resources(resources), board() {
+            placeSound = resources.RequestSound("resources/othello/place.wav");
+            flipSound = resources.RequestSound("resources/othello/flip.wav");
+            gameOverSound = resources.RequestSound("resources/othello/game_over.wav");
+        }
+        
+        // The engine protocol is 8x8 Othello, so other sizes always search in process
+        Player<N>* NewComputerPlayer() {
+            if constexpr (N == 8) {
+                if (!engineCommand.empty()) return new EngineAIPlayer(engineCommand);
+            }
+            return new AIPlayer<N>();
+        }
+
+        // Initialize players based on game mode
+        void InitPlayers(bool vsAI_mode) override {
+            vsAI = vsAI_mode;
+            delete blackPlayer;
+            delete whitePlayer;
+    
+            blackPlayer = new HumanPlayer<N>();
+            whitePlayer = vsAI_mode ? NewComputerPlayer() : (Player<N>*) new HumanPlayer<N>();
+        }
+    
+        // Handle player input
+        void HandleInput() override {
+            if (gameOver) return;
+
+            Player<N>* currentPlayer = (board.currentPlayer == Black_Disc) ? blackPlayer : whitePlayer;
+            typename Board<N>::Engine::Position before = board.position;
+
+            // AI turn handling
+            if (vsAI && board.currentPlayer == White_Disc) {
+                if (!aiThinking) {
+                    aiThinking = true;
+                    aiStartTime = GetTime();  // Start AI delay timer
+                } else if (GetTime() - aiStartTime >= aiDelay) {
+                    currentPlayer->MakeMove(board, result, gameOver);
+                    if (!currentPlayer->Thinking()) {
+                        aiThinking = false; // Reset the flag after the move
+                        CheckGameOver();
+                    }
+                }
+            }
+            // Human turn handling
+            else {
+                currentPlayer->MakeMove(board, result, gameOver);
+                CheckGameOver();
+            }
+
+            // A disc was placed this frame
+            if (othello::BitCount(board.position.Occupied()) > othello::BitCount(before.Occupied())) {
+                resources.Play(placeSound);
+                resources.Play(flipSound);
+            }
+        }
+        
+        // Draw the game
+        void Draw() override {
+            board.UpdateAnimations();
+            // Determine if we should show highlights
+            bool showHighlights = true;
+            if (vsAI) {
+                // Only show highlights during human player's turn (Black)
+                showHighlights = (board.currentPlayer == Black_Disc);
+            }
+            board.DrawBoard(showHighlights);
+            DrawHints();
+
+                // Navigation buttons
+                if (DrawSmallButton({ 10, 10, 150, 30 }, "Back to Menu")) {
+                    ResetToMenu(::gameState);
+                    return;  // Skip the rest of drawing if we're returning to menu
+                }
+                    
+                if (N == 8) {
+                    Rectangle hintsButton = { SCREEN_WIDTH - 220, 10, 100, 30 };
+                    if (DrawSmallButton(hintsButton, "Hints")) showHints = !showHints;
+                    if (showHints) DrawRectangleLinesEx(hintsButton, 2, GOLD);
+                }
+
+                if (DrawSmallButton({SCREEN_WIDTH - 110, 10, 100, 30 }, "Restart")) {
+                    ResetGame();
+                    return;
+                }
+
+            // Disc counters
+            int blackCount = 0, whiteCount = 0;
+            for (int y = 0; y < N; y++) {
+                for (int x = 0; x < N; x++) {
+                    if (board.board[y][x] == Black_Disc) blackCount++;
+                    else if (board.board[y][x] == White_Disc) whiteCount++;
+                }
+            }
+
+            // Display the score (black and white counts)
+            DrawText(TextFormat("Black: %d | White: %d", blackCount, whiteCount), 10, SCREEN_HEIGHT - 30, 20, WHITE);  
+
+            // Display whose turn it is
+            if (!gameOver) {
+                const char* turnMsg = "";
+                if (vsAI) {
+                    if (board.currentPlayer == Black_Disc)
+                        turnMsg = "Your Turn";
+                    else
+                        turnMsg = "Computer's Turn";
+                } else {
+                    turnMsg = (board.currentPlayer == Black_Disc) ? "Player 1's Turn" : "Player 2's Turn";
+                }
+        
+                int textWidth = MeasureText(turnMsg, 24);
+                DrawText(turnMsg, (GetScreenWidth() - textWidth) / 2, 10, 24, WHITE);
+            }
+        
+            // Game Over screen
+            if (gameOver) {
+                DrawRectangle(100, 200, 440, 240, Fade(RAYWHITE, 0.9f));
+        
+                const char* winnerMsg;
+                if (result == BLACK_WINS) {
+                    winnerMsg = vsAI ? "You Won!" : "Player 1 Won!";
+                } else if (result == WHITE_WINS) {
+                    winnerMsg = vsAI ? "Computer Won!" : "Player 2 Won!";
+                } else {
+                    winnerMsg = "It's a Draw!";
+                }
+        
+                DrawText("Game Over", 230, 220, 30, RED);
+                DrawText(winnerMsg, 230, 260, 30, DARKGRAY);
+        
+                if (DrawButton({ 220, 310, 200, 40 }, "Main Menu")) {
+                    ResetToMenu(::gameState);
+                } else if (DrawButton({ 220, 360, 200, 40 }, "Exit")) {
+                    CloseWindow();
+                }
+            }
+        }                             
+        // Check if game should end
+        void CheckGameOver() {
+            typedef typename Board<N>::Engine Engine;
+            const typename Engine::Position& pos = board.position;
+            int blackCount = othello::BitCount(pos.discs[othello::BLACK_SIDE]);
+            int whiteCount = othello::BitCount(pos.discs[othello::WHITE_SIDE]);
+
+            // Determine game outcome
+            if (Engine::IsGameOver(pos)) {
+                gameOver = true;
+                if (blackCount > whiteCount) result = BLACK_WINS;
+                else if (whiteCount > blackCount) result = WHITE_WINS;
+                else result = DRAW;
+                SaveScore(blackCount, whiteCount);
+                resources.Play(gameOverSound);
+            }
+            // Skip turn if current player can't move
+            else if (!othello::BitAny(Engine::LegalMoves(pos.discs[pos.sideToMove], pos.discs[pos.sideToMove ^ 1]))) {
+                board.Pass();
+            }
+        }
+                    
+        // Reset to main menu
+        void ResetToMenu(GameState& gameState) {
+            board = Board<N>();
+            gameOver = false;
+            result = NONE;
+            delete blackPlayer;
+            delete whitePlayer;
+            blackPlayer = nullptr;
+            whitePlayer = nullptr;
+            gameState = MENU;
+            aiThinking = false;
+            StopHints();
+        }
+
+        // Reset game while keeping mode
+        void ResetGame() {
+            board = Board<N>();  // Create fresh board
+            gameOver = false;
+            result = NONE;
+            aiThinking = false;
+            
+            // Keep the same game mode (vsAI or two players)
+            bool currentMode = vsAI;
+            delete blackPlayer;
+            delete whitePlayer;
+            blackPlayer = new HumanPlayer<N>();
+            whitePlayer = currentMode ? NewComputerPlayer() : (Player<N>*) new HumanPlayer<N>();
+        }
+
+        // Destructor
+        ~Game() {
+            delete blackPlayer;
+            delete whitePlayer;
+        }
+    };
+
+// Main game loop
+// Usage: othello [--engine "COMMAND"], e.g. --engine "./tactic_engine othello"
+int main(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; i++)
+        if (string(argv[i]) == "--engine") engineCommand = argv[++i];
+
+    // Initialize window
+    
+    // Trained evaluation weights from othello_trainer, if present; the built-in ones otherwise
+    weightsLoaded = othello::LoadWeights(WEIGHTS_PATH);
+    if (weightsLoaded)
+        cout << "Loaded evaluation weights from " << WEIGHTS_PATH << "\n";
+
+    // Deep 8x8 search results from earlier sessions; a second copy of the game runs without them
+    PositionCache positionCache;
+    if (positionCache.Open("othello_cache.bin", "othello"))
+        othello::UsePositionCache(&positionCache);
+
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Othello");
+    InitAudioDevice();
+    SetTargetFPS(60);
+    
+    ResourceCache resources;
+    // One game per board size; they share the same sound handles
+    Game<6> game6(resources);
+    Game<8> game8(resources);
+    Game<10> game10(resources);
+    Game<16> game16(resources);
+    GameBase* const games[] = { &game6, &game8, &game10, &game16 };
+    const int boardSizes[] = { 6, 8, 10, 16 };
+    int selectedSize = 1;       // 8x8 unless another size is picked
+    FontHandle titleFont = resources.RequestFont("resources/fonts/title.ttf", 40);
+    resources.StartLoading();   // The menu is usable straight away; assets arrive as they load
+    FramePacer pacer;
+
+    while (!WindowShouldClose()) 
+    {
+        resources.Update();
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+
+        // State machine for different screens
+        if (gameState == MENU) 
+        {
+            // Main menu screen
+            DrawTextEx(resources.GetFont(titleFont), "OTHELLO", { 220, 100 }, 40, 4, DARKGREEN);
+            DrawText("A Minute To Learn... A Lifetime To Master!", 100, 150, 20, BLACK);
+
+            if (DrawButton({ 250, 200, 150, 50 }, "Play"))
+                gameState = MODE_SELECTION;
+
+            if (DrawButton({ 250, 270, 150, 50 }, "Scores")) 
+                gameState = SCORE_HISTORY;
+
+            if (DrawButton({ 250, 340, 150, 50 }, "Exit"))
+                break;
+
+            if (!resources.IsReady())
+                DrawText(TextFormat("Loading assets... %d%%", (int)(resources.Progress() * 100)), 10, SCREEN_HEIGHT - 30, 20, GRAY);
+
+        } 
+        else if (gameState == MODE_SELECTION) 
+        {
+            // Mode selection screen
+            DrawText("Select Mode", 230, 100, 30, DARKBLUE);
+
+            if (DrawButton({ 200, 180, 240, 50 }, "Two Players")) {
+                games[selectedSize]->InitPlayers(false);
+                gameState = GAMEPLAY;
+            }
+            
+            if (DrawButton({ 200, 250, 240, 50 }, "Player vs Computer")) {
+                games[selectedSize]->InitPlayers(true);
+                gameState = GAMEPLAY;
+            }
+            
+            if (DrawButton({ 200, 320, 240, 50 }, "Back"))
+                gameState = MENU;
+
+            // Board size
+            DrawText("Board Size", 255, 400, 24, DARKBLUE);
+            for (int i = 0; i < 4; i++) {
+                Rectangle bounds = { 110.0f + i * 110, 440, 90, 30 };
+                if (DrawSmallButton(bounds, TextFormat("%dx%d", boardSizes[i], boardSizes[i])))
+                    selectedSize = i;
+                if (i == selectedSize) DrawRectangleLinesEx(bounds, 2, DARKBLUE);
+            }
+        } 
+        else if (gameState == SCORE_HISTORY) {
+            DrawRectangle(50, 50, 540, 540, Fade(RAYWHITE, 0.9f));
+            DrawText("Score History", 220, 70, 30, DARKGREEN);
+
+            std::ifstream file("scores.txt");
+            int yPos = 120;
+            char line[256];
+            
+            if (!file) {
+                DrawText("No scores recorded yet!", 200, 200, 20, DARKGRAY);
+            } else {
+                while (file.getline(line, sizeof(line))) {
+                    if (yPos > SCREEN_HEIGHT - 50) break;
+                    DrawText(line, 60, yPos, 20, DARKGRAY);
+                    yPos += 30;
+                }
+            }
+            
+            if (DrawButton({ 250, SCREEN_HEIGHT - 80, 150, 50 }, "Back")) {
+                gameState = MENU;
+            }
+        }
+        else if (gameState == GAMEPLAY) 
+        {
+            // Actual gameplay
+            games[selectedSize]->HandleInput();
+            games[selectedSize]->Draw();
+        }
+
+        // Menus and a game waiting for a click sleep until the next input event
+        FrameActivity activity = resources.IsReady() ? FRAME_IDLE : FRAME_WAITING;
+        if (gameState == GAMEPLAY) activity = max(activity, games[selectedSize]->Activity());
+        pacer.Set(activity);
+        EndDrawing();
+    }
+
+    // Clean up
+    resources.Unload();
+    CloseAudioDevice();
+    CloseWindow();
+    return 0;
+}
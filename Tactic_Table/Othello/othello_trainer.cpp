@@ -0,0 +1,346 @@
+// Offline self-play trainer for the Othello evaluation weights
+//
+//   othello_trainer [--games N] [--threads T] [--depth D] [--random-plies R] [--seed S]
+//                   [--weights FILE] [--data FILE] [--out FILE] [--ridge L]
+//
+// Plays N games of the engine against itself on every core: R random opening moves,
+// then depth-D searches for both sides (with --weights, using those weights). Every
+// position after the opening is stored with the game's final disc margin, packed into
+// 17 bytes, in the data file. Least squares then fits one weight per square class plus
+// mobility so the evaluation predicts that margin, and the result is written to --out
+// in the format LoadWeights reads (the game loads resources/othello/weights.txt).
+//
+// The data file grows in batches, each followed by a checkpoint (DATA.ckpt). Running
+// the same command again resumes after the last checkpoint; asking for more games
+// extends the data set (keep --weights the same when resuming). Game i is seeded from
+// (seed, i) alone, so the data does not depend on the thread count or where a run was
+// interrupted.
+//
+// Build: cmake target othello_trainer, or g++ -O2 -std=c++17 -pthread -I../Common OthelloEngine.cpp
+//        OthelloBatch.cpp ../Common/PositionCache.cpp othello_trainer.cpp -o othello_trainer
+
+#include "OthelloEngine.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace othello;
+
+const int BATCH_GAMES = 2048;           // Games between checkpoints
+const int NUM_FEATURES = NUM_WEIGHT_CLASSES + 1;
+const double WEIGHT_SCALE = 100;        // The largest fitted weight becomes +-100, like the corners now
+
+// One training position, from the side to move's point of view
+#pragma pack(push, 1)
+struct PackedPosition {
+    uint64_t own;
+    uint64_t opp;
+    int8_t margin;      // Final discs of the side to move minus the opponent's
+};
+#pragma pack(pop)
+static_assert(sizeof(PackedPosition) == 17, "PackedPosition must stay packed");
+
+struct Settings {
+    uint64_t games = 20000;
+    int threads = 0;
+    int depth = 4;
+    int randomPlies = 8;
+    uint64_t seed = 1;
+    std::string weightsPath;
+    std::string dataPath = "othello_train.data";
+    std::string outPath = "weights.txt";
+    double ridge = 1e-3;
+};
+
+// Where the data file had got to; the settings that shape the data must match to resume
+struct Checkpoint {
+    uint64_t games = 0;
+    uint64_t records = 0;
+    uint64_t seed = 0;
+    int depth = 0;
+    int randomPlies = 0;
+};
+
+static double NowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t Mix(uint64_t z) {
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void Features(uint64_t own, uint64_t opp, double features[NUM_FEATURES]) {
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i)
+        features[i] = __builtin_popcountll(own & WEIGHT_CLASSES[i].mask) - __builtin_popcountll(opp & WEIGHT_CLASSES[i].mask);
+    features[NUM_WEIGHT_CLASSES] = __builtin_popcountll(LegalMoves(own, opp)) - __builtin_popcountll(LegalMoves(opp, own));
+}
+
+// One self-play game; its positions are appended to out
+static void PlayGame(const Settings& settings, uint64_t game, Searcher& searcher, std::vector<PackedPosition>& out) {
+    uint64_t rng = Mix(settings.seed ^ (game * 0x9E3779B97F4A7C15ULL));
+    Position pos = StartPosition();
+    std::vector<Position> recorded;
+
+    // The table is cleared per game so a game never depends on which thread played before
+    searcher.ClearTable();
+    SearchLimits limits;
+    limits.maxDepth = settings.depth;
+
+    for (int ply = 0; !IsGameOver(pos); ++ply) {
+        MoveList list;
+        GenerateMoves(pos, list);
+        int move;
+        if (ply < settings.randomPlies) {
+            rng = Mix(rng);
+            move = list.moves[(rng >> 32) % list.count];
+        } else {
+            if (list.moves[0] != PASS) recorded.push_back(pos);
+            move = list.moves[0] == PASS ? PASS : searcher.Search(pos, limits).bestMove;
+        }
+        pos = MakeMove(pos, move);
+    }
+
+    int blackMargin = __builtin_popcountll(pos.discs[BLACK_SIDE]) - __builtin_popcountll(pos.discs[WHITE_SIDE]);
+    for (const Position& p : recorded) {
+        int side = p.sideToMove;
+        out.push_back({p.discs[side], p.discs[side ^ 1], (int8_t)(side == BLACK_SIDE ? blackMargin : -blackMargin)});
+    }
+}
+
+static bool ReadCheckpoint(const std::string& path, Checkpoint& cp) {
+    std::ifstream file(path);
+    if (!file) return false;
+    std::string key;
+    while (file >> key) {
+        if (key == "games") file >> cp.games;
+        else if (key == "records") file >> cp.records;
+        else if (key == "seed") file >> cp.seed;
+        else if (key == "depth") file >> cp.depth;
+        else if (key == "random_plies") file >> cp.randomPlies;
+        else return false;
+    }
+    return true;
+}
+
+// Written beside the data and renamed into place, so a crash leaves the old one intact
+static bool WriteCheckpoint(const std::string& path, const Checkpoint& cp) {
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream file(temp);
+        file << "games " << cp.games << "\nrecords " << cp.records << "\nseed " << cp.seed << "\ndepth " << cp.depth
+             << "\nrandom_plies " << cp.randomPlies << "\n";
+        if (!file) return false;
+    }
+    return std::rename(temp.c_str(), path.c_str()) == 0;
+}
+
+// Plays games until the data file covers settings.games; false on an I/O or settings error
+static bool Generate(const Settings& settings) {
+    std::string checkpointPath = settings.dataPath + ".ckpt";
+    Checkpoint cp;
+    if (ReadCheckpoint(checkpointPath, cp)) {
+        if (cp.seed != settings.seed || cp.depth != settings.depth || cp.randomPlies != settings.randomPlies) {
+            std::cerr << settings.dataPath << " was generated with different --seed/--depth/--random-plies;"
+                      << " use another --data file\n";
+            return false;
+        }
+        std::cout << "Resuming after " << cp.games << " games (" << cp.records << " positions)\n";
+    } else {
+        cp.seed = settings.seed;
+        cp.depth = settings.depth;
+        cp.randomPlies = settings.randomPlies;
+    }
+
+    // Drop anything written after the last checkpoint
+    namespace fs = std::filesystem;
+    if (!fs::exists(settings.dataPath)) std::ofstream(settings.dataPath, std::ios::binary);
+    std::error_code error;
+    uint64_t checkpointBytes = cp.records * sizeof(PackedPosition);
+    if (fs::file_size(settings.dataPath, error) < checkpointBytes || error) {
+        std::cerr << settings.dataPath << " is shorter than its checkpoint says\n";
+        return false;
+    }
+    fs::resize_file(settings.dataPath, checkpointBytes, error);
+    if (error) {
+        std::cerr << "Cannot truncate " << settings.dataPath << "\n";
+        return false;
+    }
+    std::ofstream data(settings.dataPath, std::ios::binary | std::ios::app);
+    if (!data) {
+        std::cerr << "Cannot open " << settings.dataPath << " for writing\n";
+        return false;
+    }
+
+    int threads = settings.threads > 0 ? settings.threads : std::max(1u, std::thread::hardware_concurrency());
+    uint64_t startGames = cp.games;
+    double startMs = NowMs();
+
+    while (cp.games < settings.games) {
+        uint64_t batch = std::min<uint64_t>(BATCH_GAMES, settings.games - cp.games);
+        std::vector<std::vector<PackedPosition>> results(batch);
+        std::atomic<uint64_t> next{0};
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                Searcher searcher(1);
+                for (uint64_t i; (i = next++) < batch;) PlayGame(settings, cp.games + i, searcher, results[i]);
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+
+        // Appended in game order, so the file is the same however the games were scheduled
+        for (const std::vector<PackedPosition>& game : results) {
+            data.write((const char*)game.data(), (std::streamsize)(game.size() * sizeof(PackedPosition)));
+            cp.records += game.size();
+        }
+        data.flush();
+        if (!data) {
+            std::cerr << "Write to " << settings.dataPath << " failed\n";
+            return false;
+        }
+        cp.games += batch;
+        if (!WriteCheckpoint(checkpointPath, cp)) {
+            std::cerr << "Cannot write " << checkpointPath << "\n";
+            return false;
+        }
+
+        double seconds = (NowMs() - startMs) / 1000.0;
+        double gamesPerSecond = (cp.games - startGames) / seconds;
+        printf("games %llu/%llu  positions %llu  %.0f games/s  %.0f positions/s  eta %.0fs\n",
+               (unsigned long long)cp.games, (unsigned long long)settings.games, (unsigned long long)cp.records,
+               gamesPerSecond, cp.records / std::max(1.0, (double)cp.games) * gamesPerSecond,
+               (settings.games - cp.games) / gamesPerSecond);
+        fflush(stdout);
+    }
+    return true;
+}
+
+// Solves (A + ridge * I) w = b by Gaussian elimination with partial pivoting
+static bool Solve(double a[NUM_FEATURES][NUM_FEATURES], double b[NUM_FEATURES], double ridge, double w[NUM_FEATURES]) {
+    double m[NUM_FEATURES][NUM_FEATURES + 1];
+    for (int i = 0; i < NUM_FEATURES; ++i) {
+        for (int j = 0; j < NUM_FEATURES; ++j) m[i][j] = a[i][j] + (i == j ? ridge : 0);
+        m[i][NUM_FEATURES] = b[i];
+    }
+    for (int col = 0; col < NUM_FEATURES; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < NUM_FEATURES; ++row)
+            if (std::fabs(m[row][col]) > std::fabs(m[pivot][col])) pivot = row;
+        if (std::fabs(m[pivot][col]) < 1e-12) return false;
+        std::swap(m[col], m[pivot]);
+        for (int row = 0; row < NUM_FEATURES; ++row) {
+            if (row == col) continue;
+            double factor = m[row][col] / m[col][col];
+            for (int j = col; j <= NUM_FEATURES; ++j) m[row][j] -= factor * m[col][j];
+        }
+    }
+    for (int i = 0; i < NUM_FEATURES; ++i) w[i] = m[i][NUM_FEATURES] / m[i][i];
+    return true;
+}
+
+// Streams the data file once for the normal equations, fits, and writes the weights
+static bool Fit(const Settings& settings) {
+    std::ifstream data(settings.dataPath, std::ios::binary);
+    double a[NUM_FEATURES][NUM_FEATURES] = {};
+    double b[NUM_FEATURES] = {};
+    double yy = 0;
+    uint64_t count = 0;
+
+    std::vector<PackedPosition> chunk(1 << 16);
+    while (data) {
+        data.read((char*)chunk.data(), (std::streamsize)(chunk.size() * sizeof(PackedPosition)));
+        size_t n = (size_t)data.gcount() / sizeof(PackedPosition);
+        for (size_t k = 0; k < n; ++k) {
+            double f[NUM_FEATURES];
+            Features(chunk[k].own, chunk[k].opp, f);
+            double y = chunk[k].margin;
+            for (int i = 0; i < NUM_FEATURES; ++i) {
+                for (int j = 0; j < NUM_FEATURES; ++j) a[i][j] += f[i] * f[j];
+                b[i] += f[i] * y;
+            }
+            yy += y * y;
+        }
+        count += n;
+    }
+    if (count == 0) {
+        std::cerr << "No positions in " << settings.dataPath << "\n";
+        return false;
+    }
+
+    // Ridge is per position, so its strength does not change with the data set size
+    double w[NUM_FEATURES];
+    if (!Solve(a, b, settings.ridge * count, w)) {
+        std::cerr << "The fit is singular; play more games\n";
+        return false;
+    }
+
+    // Residual sum of squares from the normal equations: y'y - 2 w'b + w'Aw
+    double rss = yy;
+    for (int i = 0; i < NUM_FEATURES; ++i) {
+        rss -= 2 * w[i] * b[i];
+        for (int j = 0; j < NUM_FEATURES; ++j) rss += w[i] * a[i][j] * w[j];
+    }
+
+    double largest = 1e-9;
+    for (double x : w) largest = std::max(largest, std::fabs(x));
+    EvalWeights weights;
+    for (int i = 0; i <= NUM_WEIGHT_CLASSES; ++i) {
+        int scaled = (int)std::lround(w[i] / largest * WEIGHT_SCALE);
+        if (i < NUM_WEIGHT_CLASSES) weights.classWeights[i] = scaled;
+        else weights.mobility = scaled;
+    }
+
+    printf("Fitted %llu positions, RMS error %.2f discs (margin RMS %.2f)\n", (unsigned long long)count,
+           std::sqrt(std::max(0.0, rss) / count), std::sqrt(yy / count));
+    for (int i = 0; i < NUM_WEIGHT_CLASSES; ++i)
+        printf("  %-10s %6.3f discs -> %d\n", WEIGHT_CLASSES[i].name, w[i], weights.classWeights[i]);
+    printf("  %-10s %6.3f discs -> %d\n", "mobility", w[NUM_WEIGHT_CLASSES], weights.mobility);
+
+    if (!SaveWeights(settings.outPath, weights)) {
+        std::cerr << "Cannot write " << settings.outPath << "\n";
+        return false;
+    }
+    std::cout << "Wrote " << settings.outPath << "\n";
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Settings settings;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--games") && i + 1 < argc) settings.games = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) settings.threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--depth") && i + 1 < argc) settings.depth = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--random-plies") && i + 1 < argc) settings.randomPlies = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) settings.seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--weights") && i + 1 < argc) settings.weightsPath = argv[++i];
+        else if (!strcmp(argv[i], "--data") && i + 1 < argc) settings.dataPath = argv[++i];
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc) settings.outPath = argv[++i];
+        else if (!strcmp(argv[i], "--ridge") && i + 1 < argc) settings.ridge = atof(argv[++i]);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--games N] [--threads T] [--depth D] [--random-plies R] [--seed S]\n"
+                      << "       [--weights FILE] [--data FILE] [--out FILE] [--ridge L]\n";
+            return 2;
+        }
+    }
+    if (settings.depth < 1) settings.depth = 1;
+
+    if (!settings.weightsPath.empty() && !LoadWeights(settings.weightsPath)) {
+        std::cerr << "Cannot read weights from " << settings.weightsPath << "\n";
+        return 2;
+    }
+    if (!Generate(settings)) return 1;
+    return Fit(settings) ? 0 : 1;
+}